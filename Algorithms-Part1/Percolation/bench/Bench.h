@@ -0,0 +1,172 @@
+/**
+ * \file    Bench.h
+ * \author  Christine Jones
+ * \brief   Bench namespace; utilities to facilitate micro-benchmarking.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "StopWatch.h"
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+void benchRelabel();
+void benchUnionFind();
+void benchPercolation();
+void benchTrials();
+void benchHugePages();
+
+namespace Bench {
+
+/**
+ * Repeatedly call the given function until at least the given minimum time
+ * has elapsed, and return the average elapsed time per call in seconds. The
+ * measurement is repeated the given number of times, and the fastest average
+ * is returned to reduce the effect of noise on the result.
+ */
+template <typename F>
+double measure(F&& func, double min_seconds = 0.2, int repetitions = 3) {
+
+    // warm up caches, and the branch predictor, before timing
+    func();
+
+    double best{0.0};
+    for (int r{0}; r < repetitions; ++r) {
+
+        long long calls{0};
+        StopWatch timer{};
+        double elapsed{0.0};
+        do {
+            func();
+            ++calls;
+            elapsed = timer.elapsed();
+        } while (elapsed < min_seconds);
+
+        double average{elapsed / static_cast<double>(calls)};
+        best = (r == 0) ? average : std::min(best, average);
+    }
+
+    return best;
+}
+
+/**
+ * As measure(), but the given setup function is called before every call of
+ * the measured function, and is not timed; e.g., to give each call a fresh
+ * structure to modify.
+ */
+template <typename S, typename F>
+double measureWithSetup(S&& setup, F&& func, double min_seconds = 0.2,
+                        int repetitions = 3) {
+
+    // warm up caches, and the branch predictor, before timing
+    setup();
+    func();
+
+    double best{0.0};
+    for (int r{0}; r < repetitions; ++r) {
+
+        long long calls{0};
+        double elapsed{0.0};
+        do {
+            setup();
+            StopWatch timer{};
+            func();
+            elapsed += timer.elapsed();
+            ++calls;
+        } while (elapsed < min_seconds);
+
+        double average{elapsed / static_cast<double>(calls)};
+        best = (r == 0) ? average : std::min(best, average);
+    }
+
+    return best;
+}
+
+/**
+ * Determine if the named benchmark is selected to run, i.e., its name
+ * contains the filter given on the command line.
+ */
+bool selected(std::string_view name);
+
+/**
+ * Run the named benchmark, if selected: measure the given function, then
+ * record and print the result. The result is reported as time per operation,
+ * where each call of the function performs the given number of operations.
+ * A speedup relative to a reference time per call is printed if given.
+ *
+ * \return double Time per call in seconds; zero if not selected.
+ */
+template <typename F>
+double run(std::string_view name, long long n, long long ops, F&& func,
+           double reference_seconds = 0.0);
+
+/**
+ * As run(), but the given setup function is called, untimed, before every
+ * call of the measured function; see measureWithSetup().
+ */
+template <typename S, typename F>
+double runWithSetup(std::string_view name, long long n, long long ops,
+                    S&& setup, F&& func, double reference_seconds = 0.0);
+
+/**
+ * Record and print a single benchmark result.
+ */
+void record(std::string_view name, long long n, long long ops,
+            double seconds, double reference_seconds = 0.0);
+
+/**
+ * Command line configuration; see BenchMain.cpp.
+ */
+void setFilter(std::string_view filter);
+
+/**
+ * Write all recorded results as CSV to the given file: name, n, ns per op.
+ *
+ * \return bool True if written successfully; False otherwise.
+ */
+bool writeResults(const std::string& filename);
+
+/**
+ * Compare all recorded results against the results in the given baseline
+ * CSV file. A result regresses if its time per operation exceeds the
+ * baseline by more than the given tolerance, e.g., 0.10 for 10%. Results
+ * without a baseline are reported but do not fail the comparison.
+ *
+ * \return int Number of regressed results; -1 if the baseline is unreadable.
+ */
+int compareBaseline(const std::string& filename, double tolerance);
+
+template <typename F>
+double run(std::string_view name, long long n, long long ops, F&& func,
+           double reference_seconds) {
+
+    if (!selected(name))
+        return 0.0;
+
+    double seconds{measure(func)};
+    record(name, n, ops, seconds, reference_seconds);
+
+    return seconds;
+}
+
+template <typename S, typename F>
+double runWithSetup(std::string_view name, long long n, long long ops,
+                    S&& setup, F&& func, double reference_seconds) {
+
+    if (!selected(name))
+        return 0.0;
+
+    double seconds{measureWithSetup(setup, func)};
+    record(name, n, ops, seconds, reference_seconds);
+
+    return seconds;
+}
+
+}
+
+#endif // BENCH_H
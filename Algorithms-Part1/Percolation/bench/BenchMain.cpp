@@ -0,0 +1,108 @@
+/**
+ * \file    BenchMain.cpp
+ * \author  Christine Jones
+ * \brief   Main program to run benchmarks for Percolation project.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+void printUsage() {
+
+    std::cout << "Usage: <program name> [-f <filter>] [-o <results>] "
+              << "[-b <baseline>] [-t <tolerance>]" << '\n';
+    std::cout << "\tfilter    = run only benchmarks whose name contains filter"
+              << '\n';
+    std::cout << "\tresults   = CSV file to which results are written" << '\n';
+    std::cout << "\tbaseline  = CSV file of results to compare against" << '\n';
+    std::cout << "\ttolerance = allowed slowdown vs baseline, in percent;"
+              << " defaults to 10" << '\n';
+}
+
+/**
+ * Main program. Runs all selected benchmarks, optionally writes the results
+ * as CSV, and optionally compares the results against a baseline. Returns a
+ * non-zero exit status if any result regresses beyond the tolerance.
+ *
+ * Usage: <program name> [-f <filter>] [-o <results>] [-b <baseline>]
+ *                       [-t <tolerance>]
+ */
+int main(int argc, char* argv[]) {
+
+    std::string results_file{};
+    std::string baseline_file{};
+    double      tolerance{10.0};
+
+    for (int i{1}; i < argc; ++i) {
+
+        std::string_view option{argv[i]};
+        if (i + 1 >= argc) {
+
+            printUsage();
+            return 1;
+        }
+
+        if (option == "-f") {
+
+            Bench::setFilter(argv[++i]);
+
+        } else if (option == "-o") {
+
+            results_file = argv[++i];
+
+        } else if (option == "-b") {
+
+            baseline_file = argv[++i];
+
+        } else if (option == "-t") {
+
+            std::stringstream ss{argv[++i]};
+            if (!(ss >> tolerance) || tolerance < 0.0) {
+
+                printUsage();
+                return 1;
+            }
+
+        } else {
+
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::cout << "Running Benchmarks..." << '\n' << '\n';
+    benchRelabel();
+    benchUnionFind();
+    benchPercolation();
+    benchTrials();
+    benchHugePages();
+
+    if (!results_file.empty() && !Bench::writeResults(results_file)) {
+
+        std::cerr << "Failed to write results file: " << results_file << '\n';
+        return 1;
+    }
+
+    int regressions{0};
+    if (!baseline_file.empty()) {
+
+        regressions = Bench::compareBaseline(baseline_file, tolerance / 100.0);
+        if (regressions < 0) {
+
+            std::cerr << "Failed to read baseline file: " << baseline_file
+                      << '\n';
+            return 1;
+        }
+    }
+
+    std::cout << '\n' << "COMPLETE" << '\n';
+
+    return regressions == 0 ? 0 : 2;
+}
@@ -0,0 +1,88 @@
+/**
+ * \file    BenchMemory.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of large UnionFind structures backed by standard pages
+ *          vs transparent huge pages, including data TLB misses.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "PerfCounter.h"
+#include "UnionFind.h"
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// objects in the benchmark structure; 64 MiB per array, equivalent to the
+// open sites of a 4096-by-4096 grid
+constexpr int num_objects{1 << 24};
+constexpr int num_queries{1 << 20};
+
+void benchMemory(const std::string& mode, UnionFind::Memory memory,
+                 const std::vector<std::pair<int, int>>& pairs) {
+
+    // half as many joins as objects leaves many trees of moderate height
+    WeightedUF uf{num_objects, memory};
+    for (std::size_t i{num_queries}; i < pairs.size(); ++i)
+        uf.join(pairs[i].first, pairs[i].second);
+
+    auto query = [&pairs, &uf]() {
+        int count{0};
+        for (std::size_t i{0}; i < num_queries; ++i)
+            count += uf.connected(pairs[i].first, pairs[i].second) ? 1 : 0;
+        volatile int sink{count};
+        (void)sink;
+    };
+
+    Bench::run("memory/" + mode + "/connected", num_objects, num_queries,
+               query);
+
+    if (!Bench::selected("memory/" + mode))
+        return;
+
+    PerfCounter counter{};
+    counter.start();
+    query();
+    long long misses{counter.stop()};
+
+    std::cout << "    dTLB load misses per query: ";
+    if (counter.available())
+        std::cout << std::fixed << std::setprecision(3)
+                  << static_cast<double>(misses) / num_queries
+                  << std::defaultfloat << '\n';
+    else
+        std::cout << "unavailable (perf events not permitted)" << '\n';
+}
+
+}
+
+void benchHugePages() {
+
+    std::cout << "***** UnionFind Memory *****" << '\n';
+
+    if (!Bench::selected("memory/")) {
+        std::cout << "****************************" << '\n' << '\n';
+        return;
+    }
+
+    // queries followed by joins; identical for both memory modes
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> dist{0, num_objects - 1};
+
+    std::vector<std::pair<int, int>> pairs(num_queries + (num_objects / 2));
+    for (auto& p : pairs)
+        p = {dist(gen), dist(gen)};
+
+    benchMemory("standard", UnionFind::Memory::standard, pairs);
+    benchMemory("huge-pages", UnionFind::Memory::huge_pages, pairs);
+
+    std::cout << "****************************" << '\n' << '\n';
+}
@@ -0,0 +1,104 @@
+/**
+ * \file    BenchPercolation.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of the Percolation system operations and of complete
+ *          PercolationStats trials across grid sizes.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "Percolation.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// random order in which to open all sites of an n-by-n grid
+std::vector<int> randomSites(int n) {
+
+    std::vector<int> sites(static_cast<std::size_t>(n * n));
+    std::iota(sites.begin(), sites.end(), 0);
+    std::shuffle(sites.begin(), sites.end(), std::mt19937{2024});
+
+    return sites;
+}
+
+template <typename UF>
+void benchGrid(const std::string& variant, int n) {
+
+    const auto sites{randomSites(n)};
+    long long num_sites{static_cast<long long>(sites.size())};
+
+    // open(): open every site of the grid in random order; the grid is
+    // rebuilt before each call, outside the timed region
+    std::optional<Percolation<UF>> opened{};
+    Bench::runWithSetup("percolation/" + variant + "/open", n, num_sites,
+                        [&opened, n]() { opened.emplace(n); },
+                        [&sites, &opened, n]() {
+        for (int site : sites)
+            opened->open((site / n) + 1, (site % n) + 1);
+    });
+
+    // percolates(): query a grid with roughly the threshold fraction open
+    Percolation<UF> p{n};
+    for (std::size_t i{0}; i < (sites.size() * 59) / 100; ++i)
+        p.open((sites[i] / n) + 1, (sites[i] % n) + 1);
+
+    static constexpr int queries{1'000};
+    Bench::run("percolation/" + variant + "/percolates", n, queries, [&p]() {
+        int count{0};
+        for (int i{0}; i < queries; ++i)
+            count += p.percolates() ? 1 : 0;
+        volatile int sink{count};
+        (void)sink;
+    });
+}
+
+}
+
+void benchPercolation() {
+
+    std::cout << "***** Percolation *****" << '\n';
+
+    for (int n : {16, 64})
+        benchGrid<QuickUF>("quick", n);
+
+    for (int n : {64, 256, 1024})
+        benchGrid<WeightedUF>("weighted", n);
+
+    std::cout << "***********************" << '\n' << '\n';
+}
+
+void benchTrials() {
+
+    std::cout << "***** PercolationStats Trials *****" << '\n';
+
+    static constexpr int trials{10};
+
+    for (int n : {64, 256}) {
+
+        Bench::run("trials/threshold", n, trials, [n]() {
+            PercolationStats stats{n, trials};
+        });
+
+        Bench::run("trials/clusters", n, trials, [n]() {
+            PercolationStats stats{n, trials, true};
+        });
+
+        Bench::run("trials/newman-ziff", n, trials, [n]() {
+            PercolationStats stats{n, trials, false,
+                                   PercolationStats::Method::newman_ziff};
+        });
+    }
+
+    std::cout << "************************************" << '\n' << '\n';
+}
@@ -0,0 +1,59 @@
+/**
+ * \file    BenchRelabel.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of the scalar and vectorized relabel kernels used by
+ *          the QuickUF join.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "Relabel.h"
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// number of distinct IDs in the benchmark array; many small components
+constexpr int num_components{64};
+
+double runKernel(const std::string& name,
+                 void (*kernel)(int*, std::size_t, int, int),
+                 std::vector<int>& ids, double reference = 0.0) {
+
+    long long n{static_cast<long long>(ids.size())};
+
+    // relabel back and forth so every call performs the same work
+    return Bench::run(name, n, 2 * n, [&ids, kernel]() {
+        kernel(ids.data(), ids.size(), 0, num_components);
+        kernel(ids.data(), ids.size(), num_components, 0);
+    }, reference);
+}
+
+}
+
+void benchRelabel() {
+
+    std::cout << "***** QuickUF Relabel *****" << '\n';
+    std::cout << "selected kernel: " << Relabel::kernelName() << '\n';
+
+    for (long long n : {1'000'000LL, 10'000'000LL}) {
+
+        std::vector<int> ids(static_cast<std::size_t>(n));
+        for (std::size_t i{0}; i < ids.size(); ++i)
+            ids[i] = static_cast<int>(i % num_components);
+
+        double scalar{runKernel("relabel/scalar", Relabel::relabelScalar, ids)};
+
+        if (Relabel::hasAVX2())
+            runKernel("relabel/avx2", Relabel::relabelAVX2, ids, scalar);
+
+        if (Relabel::hasAVX512())
+            runKernel("relabel/avx512", Relabel::relabelAVX512, ids, scalar);
+    }
+
+    std::cout << "***************************" << '\n' << '\n';
+}
@@ -0,0 +1,82 @@
+/**
+ * \file    BenchUnionFind.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of the find (connected) and union (join) operations of
+ *          each UnionFind algorithm variant.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "UnionFind.h"
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// random pairs of object indices, generated once so that every benchmark of
+// a given size performs identical operations
+std::vector<std::pair<int, int>> randomPairs(int n, std::size_t count) {
+
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> dist{0, n - 1};
+
+    std::vector<std::pair<int, int>> pairs(count);
+    for (auto& p : pairs)
+        p = {dist(gen), dist(gen)};
+
+    return pairs;
+}
+
+template <typename UF>
+void benchVariant(const std::string& variant, int n) {
+
+    const std::size_t num_ops{static_cast<std::size_t>(n)};
+    const auto pairs{randomPairs(n, num_ops)};
+    long long ops{static_cast<long long>(num_ops)};
+
+    // union: join random pairs, starting from all objects disconnected; the
+    // structure is rebuilt before each call, outside the timed region
+    std::optional<UF> joined{};
+    Bench::runWithSetup("uf/" + variant + "/join", n, ops,
+                        [&joined, n]() { joined.emplace(n); },
+                        [&pairs, &joined]() {
+        for (const auto& [p, q] : pairs)
+            joined->join(p, q);
+    });
+
+    // find: query random pairs of a structure built from half as many joins
+    UF uf{n};
+    for (std::size_t i{0}; i < num_ops / 2; ++i)
+        uf.join(pairs[i].first, pairs[i].second);
+
+    Bench::run("uf/" + variant + "/connected", n, ops, [&pairs, &uf]() {
+        int count{0};
+        for (const auto& [p, q] : pairs)
+            count += uf.connected(q, p) ? 1 : 0;
+        volatile int sink{count};
+        (void)sink;
+    });
+}
+
+}
+
+void benchUnionFind() {
+
+    std::cout << "***** UnionFind *****" << '\n';
+
+    // QuickUF join is linear in the number of objects
+    for (int n : {1'000, 10'000})
+        benchVariant<QuickUF>("quick", n);
+
+    for (int n : {10'000, 1'000'000})
+        benchVariant<WeightedUF>("weighted", n);
+
+    std::cout << "*********************" << '\n' << '\n';
+}
@@ -0,0 +1,76 @@
+/**
+ * \file    PerfCounter.cpp
+ * \author  Christine Jones
+ * \brief   Very simple class that counts data TLB misses of the calling
+ *          thread using Linux perf events.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "PerfCounter.h"
+
+#if defined(__linux__)
+
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+PerfCounter::PerfCounter() {
+
+    perf_event_attr attr{};
+    std::memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // calling thread, any CPU, no group, no flags
+    m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+PerfCounter::~PerfCounter() {
+
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+void PerfCounter::start() {
+
+    if (m_fd < 0)
+        return;
+
+    ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+long long PerfCounter::stop() {
+
+    if (m_fd < 0)
+        return 0;
+
+    ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+    std::uint64_t count{0};
+    if (read(m_fd, &count, sizeof(count)) != sizeof(count))
+        return 0;
+
+    return static_cast<long long>(count);
+}
+
+#else // !__linux__
+
+PerfCounter::PerfCounter() {}
+PerfCounter::~PerfCounter() {}
+void PerfCounter::start() {}
+long long PerfCounter::stop() { return 0; }
+
+#endif // __linux__
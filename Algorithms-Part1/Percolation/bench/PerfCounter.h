@@ -0,0 +1,60 @@
+/**
+ * \file    PerfCounter.h
+ * \author  Christine Jones
+ * \brief   Very simple class that counts data TLB misses of the calling
+ *          thread using Linux perf events.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+/**
+ * Class that counts data TLB load misses of the calling thread, in user
+ * space only. Counting requires Linux and permission to open perf events
+ * (see /proc/sys/kernel/perf_event_paranoid); if unavailable, e.g., within
+ * a virtual machine that does not expose hardware counters, available()
+ * returns False and all counts are reported as zero.
+ */
+class PerfCounter {
+
+public:
+
+    /**
+     * Constructor. Opens, but does not start, the counter.
+     */
+    PerfCounter();
+
+    /**
+     * Destructor. Closes the counter.
+     */
+    ~PerfCounter();
+
+    /**
+     * Determine if the counter was successfully opened.
+     */
+    bool available() const { return m_fd >= 0; }
+
+    /**
+     * Reset and start counting.
+     */
+    void start();
+
+    /**
+     * Stop counting and return the number of events counted since start().
+     */
+    long long stop();
+
+    // copying, assigning a counter is not supported
+    PerfCounter(const PerfCounter& counter) = delete;
+    PerfCounter& operator= (const PerfCounter& counter) = delete;
+
+private:
+
+    int m_fd{-1};   // perf event file descriptor
+
+};
+
+#endif // PERF_COUNTER_H
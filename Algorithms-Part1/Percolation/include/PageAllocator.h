@@ -0,0 +1,133 @@
+/**
+ * \file    PageAllocator.h
+ * \author  Christine Jones
+ * \brief   Definition of an allocator that optionally backs large
+ *          allocations with transparent huge pages.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef PAGE_ALLOCATOR_H
+#define PAGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>      // for std::aligned_alloc, std::free
+#include <limits>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>   // for madvise
+#endif
+
+/**
+ * Allocator that optionally requests transparent huge pages for large
+ * allocations. Large arrays that are accessed at random, e.g., the object IDs
+ * of a UnionFind with millions of objects, touch a different page on nearly
+ * every access; backing the array with 2 MiB huge pages, rather than 4 KiB
+ * pages, greatly reduces the number of TLB misses.
+ *
+ * If huge pages are requested, allocations of at least one huge page are
+ * aligned to, and rounded up to a multiple of, the huge page size, and the
+ * kernel is advised to back the allocation with huge pages (Linux only; the
+ * advice is silently ignored if transparent huge pages are disabled). Smaller
+ * allocations, and all allocations if huge pages are not requested, are
+ * served by the global operator new.
+ *
+ * The allocator does not touch the memory it returns. Memory is therefore
+ * placed on the NUMA node of the thread that first writes to it, i.e., the
+ * thread that constructs the container. Multi-threaded clients should
+ * construct each thread's containers on that thread.
+ */
+template <typename T>
+class PageAllocator {
+
+public:
+
+    using value_type = T;
+
+    // size and alignment of a transparent huge page on x86-64 and AArch64
+    static constexpr std::size_t huge_page_size{std::size_t{2} << 20};
+
+    /**
+     * Constructor.
+     *
+     * \param bool True to request huge pages for large allocations; defaults
+     *             to False.
+     */
+    explicit PageAllocator(bool huge_pages = false) noexcept:
+        m_huge_pages{huge_pages}
+    {}
+
+    template <typename U>
+    PageAllocator(const PageAllocator<U>& other) noexcept:
+        m_huge_pages{other.usesHugePages()}
+    {}
+
+    /**
+     * Determine if huge pages are requested for large allocations.
+     */
+    bool usesHugePages() const noexcept { return m_huge_pages; }
+
+    /**
+     * Allocate uninitialized memory for the given number of objects. An
+     * exception of type std::bad_alloc is thrown in the case that memory
+     * fails to be allocated.
+     */
+    T* allocate(std::size_t n);
+
+    /**
+     * Release memory previously allocated for the given number of objects.
+     */
+    void deallocate(T* ptr, std::size_t n) noexcept;
+
+    friend bool operator==(const PageAllocator& a, const PageAllocator& b)
+        { return a.m_huge_pages == b.m_huge_pages; }
+
+private:
+
+    // huge page path used for the given allocation size
+    bool isHuge(std::size_t bytes) const
+        { return m_huge_pages && bytes >= huge_page_size; }
+
+    bool m_huge_pages{false};
+
+};
+
+template <typename T>
+T* PageAllocator<T>::allocate(std::size_t n) {
+
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_array_new_length{};
+
+    std::size_t bytes{n * sizeof(T)};
+
+    if (!isHuge(bytes))
+        return static_cast<T*>(::operator new(bytes));
+
+    // aligned_alloc requires the size to be a multiple of the alignment
+    std::size_t rounded{
+        ((bytes + huge_page_size - 1) / huge_page_size) * huge_page_size};
+
+    void* ptr{std::aligned_alloc(huge_page_size, rounded)};
+    if (ptr == nullptr)
+        throw std::bad_alloc{};
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // advice only; failure leaves the memory backed by standard pages
+    madvise(ptr, rounded, MADV_HUGEPAGE);
+#endif
+
+    return static_cast<T*>(ptr);
+}
+
+template <typename T>
+void PageAllocator<T>::deallocate(T* ptr, std::size_t n) noexcept {
+
+    if (isHuge(n * sizeof(T)))
+        std::free(ptr);
+    else
+        ::operator delete(ptr);
+}
+
+#endif // PAGE_ALLOCATOR_H
@@ -13,12 +13,18 @@
 #define PERCOLATION_H
 
 #include "UnionFind.h"
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <random>
 #include <sstream>
 #include <string>
+#include <vector>
+
+template <typename UF>
+class Percolation;
 
 /**
  * Class that performs Monte-Carlo style experiments using the model
@@ -33,24 +39,52 @@
  * 
  * A more accurate estimate of the percolation threshold is calculated by
  * averaging the results over all the trials. 
+ *
+ * Optionally, cluster observables are also recorded at the percolation
+ * threshold of each trial: the mean cluster size, the largest cluster size,
+ * and the mass of the spanning cluster. These are tracked incrementally by
+ * the percolation system as sites are opened, and averaged over all trials.
+ *
+ * Alternatively, trials may be run using the Newman-Ziff algorithm. Each
+ * trial opens all sites, in a uniformly random order, and records whether the
+ * system percolates and the size of the largest cluster for every number of
+ * open sites, k. The percolation threshold of the trial is the value of k at
+ * which the system first percolates. The observables for a given probability
+ * p that a site is open are then calculated by weighting the observables for
+ * each k by the binomial probability that exactly k sites are open. A single
+ * set of trials thereby yields observables for all p.
  * 
  * The Weighted Union Find algorithm implements the underlying connection
- * process of the percolation system. Future work should allow the Union Find
- * algorithm variant to be a configurable option. This would allow greater
- * flexibilty in running experiments and comparison of Union Find algorithms.
+ * process of the percolation system. Its storage is backed by huge pages
+ * when large enough, reducing TLB misses for large grids. Future work should
+ * allow the Union Find algorithm variant to be a configurable option. This
+ * would allow greater flexibilty in running experiments and comparison of
+ * Union Find algorithms.
  */
 class PercolationStats {
 
 public:
 
+    /**
+     * Methods used to run the independent trials.
+     *
+     * threshold:   open random sites until the system percolates.
+     * newman_ziff: open all sites in random order, recording observables for
+     *              every number of open sites.
+     */
+    enum class Method { threshold, newman_ziff };
+
     /**
      * Constructor. The given number of independent trials is run, and
      * statistics calculated.
      * 
      * \param int n-by-n grid size; must be greater than zero.
      * \param int Number of independent trials; must be greater than zero.
+     * \param bool True to record cluster observables; defaults to False.
+     * \param Method Method used to run trials; defaults to threshold.
      */
-    PercolationStats(int n, int trials);
+    PercolationStats(int n, int trials, bool track_clusters = false,
+                     Method method = Method::threshold);
 
     /**
      * Methods for accessing percolation threshold statistics: mean, standard
@@ -61,14 +95,71 @@ public:
     double confidenceLow() const  { return m_confidence_low; }
     double confidenceHigh() const { return m_confidence_high; }
 
+    /**
+     * Methods for accessing cluster observables at the percolation threshold,
+     * averaged over all trials: mean (finite) cluster size, largest cluster
+     * size, and spanning cluster mass, in number of sites. Only recorded if
+     * requested at construction; zero otherwise.
+     */
+    bool   tracksClusters() const      { return m_track_clusters; }
+    double meanClusterSize() const     { return m_mean_cluster_size; }
+    double largestClusterSize() const  { return m_largest_cluster_size; }
+    double spanningClusterSize() const { return m_spanning_cluster_size; }
+
+    /**
+     * Methods for accessing observables as a function of the probability that
+     * a site is open: the probability that the system percolates, and the
+     * mean fraction of sites in the largest cluster. Only available if trials
+     * were run using the Newman-Ziff method.
+     *
+     * \param double Probability that a site is open; must be between zero
+     *               and one, inclusive.
+     */
+    Method method() const { return m_method; }
+    double spanningProbability(double p) const;
+    double largestClusterFraction(double p) const;
+
+    /**
+     * Methods for accessing observables as a function of the number of open
+     * sites, k, indexed from zero to (n*n) inclusive. Only available if trials
+     * were run using the Newman-Ziff method.
+     */
+    const std::vector<double>& spanningByOccupancy() const
+        { return m_spanning_by_occupancy; }
+    const std::vector<double>& largestByOccupancy() const
+        { return m_largest_by_occupancy; }
+
 private:
 
     /**
      * Run single trial. Instantiates a percolation system and opens sites
      * uniformily at random until system percolates. Returns the number of
-     * sites opened.
+     * sites opened. Cluster observables, if tracked, are recorded for the
+     * given trial.
+     */
+    int  percolate(std::size_t trial);
+
+    /**
+     * Run single trial using the Newman-Ziff method. Opens all sites in a
+     * uniformly random order, accumulating observables for each number of
+     * open sites. Returns the number of sites opened when the system first
+     * percolates. Cluster observables, if tracked, are recorded for the given
+     * trial at that point.
+     */
+    int  sweep(std::size_t trial);
+
+    /**
+     * Record cluster observables of the given percolation system for the
+     * given trial.
      */
-    int  percolate();
+    void record_clusters(std::size_t trial, Percolation<WeightedUF>& p);
+
+    /**
+     * Weight the given observable, indexed by number of open sites, by the
+     * binomial distribution of the number of open sites given probability p
+     * that each site is open.
+     */
+    static double convolve(const std::vector<double>& observable, double p);
 
     /**
      * Run all trials; record the percolation threshold for each trial.
@@ -77,21 +168,38 @@ private:
 
     /**
      * Given recorded percolation thresholds for all trials, calculate
-     * statistics: mean, standard deviation, 95% confidence interval.
+     * statistics: mean, standard deviation, 95% confidence interval. Cluster
+     * observables, if tracked, are averaged over all trials.
      */
     void calculate_stats();
 
-    const int m_grid_size{};
-    const int m_num_trials{};
+    const int    m_grid_size{};
+    const int    m_num_trials{};
+    const bool   m_track_clusters{};
+    const Method m_method{};
 
     // single percolation threshold recorded for each trial run
     std::vector<double> m_percolate_thresholds{};
 
+    // cluster observables recorded for each trial run, if tracked
+    std::vector<double> m_mean_cluster_sizes{};
+    std::vector<double> m_largest_cluster_sizes{};
+    std::vector<double> m_spanning_cluster_sizes{};
+
+    // Newman-Ziff observables indexed by number of open sites; accumulated
+    // over all trials, then averaged
+    std::vector<double> m_spanning_by_occupancy{};
+    std::vector<double> m_largest_by_occupancy{};
+
     double m_mean{};
     double m_stddev{};
     double m_confidence_low{};
     double m_confidence_high{};
 
+    double m_mean_cluster_size{};
+    double m_largest_cluster_size{};
+    double m_spanning_cluster_size{};
+
 };
 
 /**
@@ -105,6 +213,12 @@ private:
  * 
  * An open-enabled UnionFind algorithm is required as class input via template
  * parameter. The UnionFind algorithm manages connections within the grid.
+ *
+ * Optionally, the system tracks the clusters of open sites, i.e., groups of
+ * open sites connected via chains of open neighboring sites. Clusters are
+ * tracked incrementally with a second Weighted UnionFind over the grid sites
+ * only; the virtual top and bottom sites would otherwise merge all clusters
+ * touching the top row, or the bottom row, into a single cluster.
  */
 template <typename UF>
 class Percolation {
@@ -115,8 +229,12 @@ public:
      * Constructor. Initializes a completely blocked n-by-n grid
      * 
      * \param int n-by-n grid size; must be greater than zero.
+     * \param bool True to track clusters of open sites; defaults to False.
+     * \param Memory Memory used for UnionFind storage; defaults to standard.
      */
-    explicit Percolation(int n);
+    explicit Percolation(
+        int n, bool track_clusters = false,
+        UnionFind::Memory memory = UnionFind::Memory::standard);
 
     /**
      * Determine if the given grid site is open.
@@ -169,6 +287,24 @@ public:
      */
     bool percolates();
 
+    /**
+     * Methods for accessing cluster observables; clusters must be tracked.
+     *
+     * numberOfClusters(): number of distinct clusters of open sites.
+     * largestClusterSize(): number of sites in the largest cluster.
+     * spanningClusterSize(): number of sites in the cluster that first
+     *      connected the top and bottom rows; zero if the system does not
+     *      percolate.
+     * meanClusterSize(): mean size of the cluster that a randomly chosen open
+     *      site belongs to, excluding the spanning cluster, i.e., the sum of
+     *      squared cluster sizes divided by the number of open sites.
+     */
+    bool   tracksClusters() const   { return m_clusters.has_value(); }
+    int    numberOfClusters() const;
+    int    largestClusterSize() const;
+    int    spanningClusterSize();
+    double meanClusterSize();
+
     /**
      * Print n-by-n grid and additional class data to stdout for testing
      * purposes.
@@ -196,6 +332,19 @@ private:
     void connectRightNeighbor(int row, int col);
     void connectLeftNeighbor(int row, int col);
 
+    /**
+     * Join two neighboring open grid sites; updates cluster observables if
+     * clusters are tracked.
+     */
+    void joinSites(int p, int q);
+
+    /**
+     * Record that a newly opened grid site forms its own cluster; if the
+     * system now percolates, record the site as part of the spanning cluster.
+     */
+    void addCluster();
+    void checkSpanning(int p);
+
     // UnionFind algorithm used to manage open connections within the grid.
     //
     // The n-by-n grid is stored as a flat vector. In addition there is a
@@ -216,21 +365,40 @@ private:
 
     int m_num_open_sites{};
 
+    // clusters of open grid sites, without virtual top and bottom; the size
+    // is ((n*n) + 1) so grid sites share the same index as in m_openUF
+    std::optional<WeightedUF> m_clusters{};
+
+    int       m_num_clusters{};
+    int       m_largest_cluster{};
+    long long m_sum_squared_sizes{}; // sum of squared cluster sizes
+    int       m_spanning_site{};     // site in spanning cluster; -1 if none
+
 };
 
 template <typename UF>
-Percolation<UF>::Percolation(int n):
-    m_openUF{(n * n) + 2}, // 2 additional sites for virtual top and bottom
+Percolation<UF>::Percolation(int n, bool track_clusters,
+                             UnionFind::Memory memory):
+    // 2 additional sites for virtual top and bottom
+    m_openUF{(n * n) + 2, memory},
     m_grid_size{n},
     m_top_index{0},
     m_bottom_index{(n * n) + 1},
-    m_num_open_sites{0}
+    m_num_open_sites{0},
+    m_clusters{},
+    m_num_clusters{0},
+    m_largest_cluster{0},
+    m_sum_squared_sizes{0},
+    m_spanning_site{-1}
 {
     assert(n > 0);
 
     // open virtual top and bottom
     m_openUF.open(m_top_index);
     m_openUF.open(m_bottom_index);
+
+    if (track_clusters)
+        m_clusters.emplace((n * n) + 1, memory);
 }
 
 template <typename UF>
@@ -254,10 +422,18 @@ void Percolation<UF>::open(int row, int col) {
     if (isOpen(row, col))
         return;
 
-    m_openUF.open(indexIntoUF(row, col));
+    int site{indexIntoUF(row, col)};
+
+    m_openUF.open(site);
     ++m_num_open_sites;
 
+    if (m_clusters)
+        addCluster();
+
     connectNeighbors(row, col);
+
+    if (m_clusters)
+        checkSpanning(site);
 }
 
 template <typename UF>
@@ -266,6 +442,46 @@ bool Percolation<UF>::percolates() {
     return m_openUF.connected(m_top_index, m_bottom_index);
 }
 
+template <typename UF>
+int Percolation<UF>::numberOfClusters() const {
+
+    assert(m_clusters);
+    return m_num_clusters;
+}
+
+template <typename UF>
+int Percolation<UF>::largestClusterSize() const {
+
+    assert(m_clusters);
+    return m_largest_cluster;
+}
+
+template <typename UF>
+int Percolation<UF>::spanningClusterSize() {
+
+    assert(m_clusters);
+
+    if (m_spanning_site < 0)
+        return 0;
+
+    return m_clusters->size(m_spanning_site);
+}
+
+template <typename UF>
+double Percolation<UF>::meanClusterSize() {
+
+    assert(m_clusters);
+
+    long long spanning{spanningClusterSize()};
+    long long finite_sites{m_num_open_sites - spanning};
+
+    if (finite_sites == 0)
+        return 0.0;
+
+    return static_cast<double>(m_sum_squared_sizes - (spanning * spanning)) /
+           static_cast<double>(finite_sites);
+}
+
 template <typename UF>
 std::string Percolation<UF>::toStr() const {
 
@@ -320,7 +536,7 @@ void Percolation<UF>::connectTopNeighbor(int row, int col) {
     }
 
     if (isOpen(row - 1, col))
-        m_openUF.join(indexIntoUF(row - 1, col), indexIntoUF(row, col));
+        joinSites(indexIntoUF(row - 1, col), indexIntoUF(row, col));
 }
 
 template <typename UF>
@@ -333,7 +549,7 @@ void Percolation<UF>::connectBottomNeighbor(int row, int col) {
     }
 
     if (isOpen(row + 1, col))
-        m_openUF.join(indexIntoUF(row + 1, col), indexIntoUF(row, col));
+        joinSites(indexIntoUF(row + 1, col), indexIntoUF(row, col));
 }
 
 template <typename UF>
@@ -344,7 +560,7 @@ void Percolation<UF>::connectRightNeighbor(int row, int col) {
         return;
 
     if (isOpen(row, col + 1))
-        m_openUF.join(indexIntoUF(row, col + 1), indexIntoUF(row, col));
+        joinSites(indexIntoUF(row, col + 1), indexIntoUF(row, col));
 }
 
 template <typename UF>
@@ -355,7 +571,47 @@ void Percolation<UF>::connectLeftNeighbor(int row, int col) {
         return;
 
     if (isOpen(row, col - 1))
-        m_openUF.join(indexIntoUF(row, col - 1), indexIntoUF(row, col));
+        joinSites(indexIntoUF(row, col - 1), indexIntoUF(row, col));
+}
+
+template <typename UF>
+void Percolation<UF>::joinSites(int p, int q) {
+
+    m_openUF.join(p, q);
+
+    if (!m_clusters || m_clusters->connected(p, q))
+        return;
+
+    // merging clusters of sizes a and b changes the sum of squared sizes by
+    // (a + b)^2 - a^2 - b^2 = 2ab
+    long long a{m_clusters->size(p)};
+    long long b{m_clusters->size(q)};
+
+    m_clusters->join(p, q);
+
+    m_sum_squared_sizes += 2 * a * b;
+    --m_num_clusters;
+    m_largest_cluster = std::max(m_largest_cluster, static_cast<int>(a + b));
+}
+
+template <typename UF>
+void Percolation<UF>::addCluster() {
+
+    assert(m_clusters);
+
+    ++m_num_clusters;
+    m_sum_squared_sizes += 1;
+    m_largest_cluster = std::max(m_largest_cluster, 1);
+}
+
+template <typename UF>
+void Percolation<UF>::checkSpanning(int p) {
+
+    assert(m_clusters);
+
+    // the site that first connects top and bottom is in the spanning cluster
+    if (m_spanning_site < 0 && percolates())
+        m_spanning_site = p;
 }
 
 #endif // PERCOLATION_H
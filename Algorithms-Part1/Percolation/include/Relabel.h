@@ -0,0 +1,57 @@
+/**
+ * \file    Relabel.h
+ * \author  Christine Jones
+ * \brief   Relabel namespace; kernels that replace every occurrence of one
+ *          object ID with another across an array of object IDs.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef RELABEL_H
+#define RELABEL_H
+
+#include <cstddef>
+
+/**
+ * The relabel operation is the inner loop of the Quick UnionFind join, which
+ * visits every object ID on each join. Explicitly vectorized variants are
+ * provided for x86 processors that support AVX2 or AVX-512, along with a
+ * portable scalar variant. The relabel() function selects the fastest variant
+ * supported by the running processor the first time it is called.
+ */
+namespace Relabel {
+
+/**
+ * Replace every occurrence of the given ID with the new ID using the fastest
+ * kernel supported by the running processor.
+ *
+ * \param int* Array of object IDs.
+ * \param std::size_t Number of object IDs in the array.
+ * \param int Object ID to be replaced.
+ * \param int Replacement object ID.
+ */
+void relabel(int* ids, std::size_t n, int from, int to);
+
+/**
+ * Individual relabel kernels; parameters as per relabel(). The vectorized
+ * kernels must only be called if supported by the running processor.
+ */
+void relabelScalar(int* ids, std::size_t n, int from, int to);
+void relabelAVX2(int* ids, std::size_t n, int from, int to);
+void relabelAVX512(int* ids, std::size_t n, int from, int to);
+
+/**
+ * Determine if the running processor supports the vectorized kernels.
+ */
+bool hasAVX2();
+bool hasAVX512();
+
+/**
+ * Name of the kernel selected by relabel(), for reporting purposes.
+ */
+const char* kernelName();
+
+} // namespace Relabel
+
+#endif // RELABEL_H
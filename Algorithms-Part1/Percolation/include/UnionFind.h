@@ -10,6 +10,7 @@
 #ifndef UNION_FIND_H
 #define UNION_FIND_H
 
+#include "PageAllocator.h"
 #include <cassert>
 #include <numeric>  // std::iota
 #include <string>
@@ -21,20 +22,33 @@
 class UnionFind {
 
 public:
+
+    /**
+     * Memory used to store the per-object arrays of the algorithm.
+     *
+     * standard:   memory from the global operator new.
+     * huge_pages: arrays of at least one huge page (2 MiB) are backed by
+     *             transparent huge pages, reducing TLB misses when accessing
+     *             large arrays at random.
+     */
+    enum class Memory { standard, huge_pages };
+
     /**
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero.
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    explicit UnionFind(int n);
+    explicit UnionFind(int n, Memory memory = Memory::standard);
 
     /**
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero.
      * \param int Value used to initialize object IDs; defaults to zero. 
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    UnionFind(int n, int initial_value);
+    UnionFind(int n, int initial_value, Memory memory = Memory::standard);
     
     /**
      *  Destructor.
@@ -90,8 +104,15 @@ protected:
      */
     bool isValidIndex(int i) const;
 
+    // storage for per-object arrays; huge pages optional
+    using Array = std::vector<int, PageAllocator<int>>;
+
+    // allocator for per-object arrays given the requested memory
+    static PageAllocator<int> allocator(Memory memory)
+        { return PageAllocator<int>{memory == Memory::huge_pages}; }
+
     // object identifiers used in determining connection relationships
-    std::vector<int> m_object_ids{};
+    Array m_object_ids{};
 
 };
 
@@ -105,16 +126,18 @@ public:
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero.
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    explicit QuickUF(int n);
+    explicit QuickUF(int n, Memory memory = Memory::standard);
 
     /**
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero.
      * \param int Value used to initialize object IDs; defaults to zero. 
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    QuickUF(int n, int initial_value);
+    QuickUF(int n, int initial_value, Memory memory = Memory::standard);
 
     /**
      * Destructor.
@@ -157,16 +180,18 @@ public:
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero.
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    explicit WeightedUF(int n);
+    explicit WeightedUF(int n, Memory memory = Memory::standard);
 
     /**
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero.
      * \param int Value used to initialize object IDs; defaults to zero. 
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    WeightedUF(int n, int initial_value);
+    WeightedUF(int n, int initial_value, Memory memory = Memory::standard);
 
     /**
      * Destructor.
@@ -195,6 +220,18 @@ public:
      */
     void join(int p, int q) override;
 
+    /**
+     * Determine the number of objects in the given object's component, i.e.,
+     * the size of the tree the object belongs to.
+     *
+     * \param int Object index; must be greater or equal to zero and less than
+     *            total number of objects.
+     *
+     * \return int Number of objects connected to the given object, including
+     *             the object itself.
+     */
+    int size(int p);
+
     /**
      * Convert object to string format for testing purposes.
      */
@@ -211,7 +248,7 @@ private:
     static constexpr int initial_tree_size{1};
 
     // tree size corresponding to each object
-    std::vector<int> m_tree_sizes{};
+    Array m_tree_sizes{};
 
 };
 
@@ -232,8 +269,10 @@ public:
      * Constructor.
      * 
      * \param int Number of connectivity objects; must be greater than zero. 
+     * \param Memory Memory used for object storage; defaults to standard.
      */
-    explicit OpenUF(int n);
+    explicit OpenUF(int n,
+                    UnionFind::Memory memory = UnionFind::Memory::standard);
 
     /**
      * Determines if given object is open for join.
@@ -274,6 +313,19 @@ public:
      *            total number of objects.
      */
     void join(int p, int q) override;
+
+    /**
+     * Determine the number of objects in the given object's component. Only
+     * available if the base UnionFind algorithm provides a size query, e.g.,
+     * WeightedUF.
+     *
+     * \param int Object index; must be greater or equal to zero and less than
+     *            total number of objects.
+     *
+     * \return int Number of objects connected to the given object; zero if
+     *             the given object is not open.
+     */
+    int size(int p);
     
 private:
 
@@ -283,8 +335,8 @@ private:
 };
 
 template <class T>
-OpenUF<T>::OpenUF(int n):
-    T{n, blocked}
+OpenUF<T>::OpenUF(int n, UnionFind::Memory memory):
+    T{n, blocked, memory}
 {}
 
 template <class T>
@@ -324,4 +376,13 @@ void OpenUF<T>::join(int p, int q) {
     return T::join(p, q);
 }
 
+template <class T>
+int OpenUF<T>::size(int p) {
+
+    if (!isOpen(p))
+        return 0;
+
+    return T::size(p);
+}
+
 #endif // UNION_FIND_H
@@ -9,61 +9,77 @@
  */
 
 #include "Percolation.h"
+#include "Random.h"
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <numeric>
 
-/**
- * Random number generator.
- */
-namespace Random {
-
-std::random_device rd{};
-std::mt19937 genMT{rd()};
-
-/**
- * Returns a random number between the given min and max, inclusive, using a
- * uniform distribution.
- * 
- * \param int Minimum number.
- * \param int Maximum number; must be greater or equal to minimum number.
- * 
- * \return int Number between given min and max, inclusive.
- */
-int getRandomNumber(int min, int max) {
-
-    assert(min <= max);
-    return std::uniform_int_distribution{min, max}(genMT);
-}
-
-} // namespace Random
-
-PercolationStats::PercolationStats(int n, int trials):
+PercolationStats::PercolationStats(int n, int trials, bool track_clusters,
+                                   Method method):
     m_grid_size{n},
     m_num_trials{trials},
+    m_track_clusters{track_clusters},
+    m_method{method},
     m_percolate_thresholds{
         std::vector<double>(static_cast<std::size_t>(trials))},
+    m_mean_cluster_sizes{},
+    m_largest_cluster_sizes{},
+    m_spanning_cluster_sizes{},
+    m_spanning_by_occupancy{},
+    m_largest_by_occupancy{},
     m_mean{0.0},
     m_stddev{0.0},
     m_confidence_low{0.0},
-    m_confidence_high{0.0}
+    m_confidence_high{0.0},
+    m_mean_cluster_size{0.0},
+    m_largest_cluster_size{0.0},
+    m_spanning_cluster_size{0.0}
 {
     assert(m_grid_size > 0);
     assert(m_num_trials > 0);
 
+    if (m_track_clusters) {
+
+        std::size_t num_trials{static_cast<std::size_t>(trials)};
+        m_mean_cluster_sizes.resize(num_trials);
+        m_largest_cluster_sizes.resize(num_trials);
+        m_spanning_cluster_sizes.resize(num_trials);
+    }
+
+    if (m_method == Method::newman_ziff) {
+
+        // one entry for each number of open sites, zero through n*n
+        std::size_t num_sites{static_cast<std::size_t>(n) *
+                              static_cast<std::size_t>(n)};
+        m_spanning_by_occupancy.resize(num_sites + 1, 0.0);
+        m_largest_by_occupancy.resize(num_sites + 1, 0.0);
+    }
+
     run_experiments();
     calculate_stats();  
 }
 
-int PercolationStats::percolate() {
+int PercolationStats::percolate(std::size_t trial) {
 
     // TBD: configuration of the Union Find algorithm variant
-    Percolation<WeightedUF> p{m_grid_size};
+    Percolation<WeightedUF> p{m_grid_size, m_track_clusters,
+                              UnionFind::Memory::huge_pages};
+
+    // rows and columns are drawn in batches, refilled when used up
+    std::array<int, 256> draws{};
+    std::size_t next{draws.size()};
 
     while (!p.percolates()) {
 
-        int row{Random::getRandomNumber(1, m_grid_size)};
-        int col{Random::getRandomNumber(1, m_grid_size)};
+        if (next == draws.size()) {
+            Random::getRandomNumbers(1, m_grid_size, draws);
+            next = 0;
+        }
+
+        int row{draws[next++]};
+        int col{draws[next++]};
 
         if (p.isOpen(row, col))
             continue;
@@ -71,16 +87,140 @@ int PercolationStats::percolate() {
         p.open(row, col);
     }
 
+    if (m_track_clusters)
+        record_clusters(trial, p);
+
     return p.numberOfOpenSites();
 }
 
+int PercolationStats::sweep(std::size_t trial) {
+
+    // clusters always tracked to record the largest cluster size
+    Percolation<WeightedUF> p{m_grid_size, true,
+                              UnionFind::Memory::huge_pages};
+
+    // uniformly random order in which to open sites (Fisher-Yates shuffle)
+    std::vector<int> order(m_spanning_by_occupancy.size() - 1);
+    std::iota(order.begin(), order.end(), 0);
+    for (std::size_t i{order.size() - 1}; i > 0; --i) {
+
+        std::size_t j{static_cast<std::size_t>(
+            Random::getRandomNumber(0, static_cast<int>(i)))};
+        std::swap(order[i], order[j]);
+    }
+
+    int threshold{0};
+    for (std::size_t k{1}; k <= order.size(); ++k) {
+
+        int site{order[k - 1]};
+        p.open((site / m_grid_size) + 1, (site % m_grid_size) + 1);
+
+        if (threshold == 0 && p.percolates()) {
+
+            threshold = static_cast<int>(k);
+            if (m_track_clusters)
+                record_clusters(trial, p);
+        }
+
+        // once percolating, the system percolates for all larger k
+        if (threshold != 0)
+            m_spanning_by_occupancy[k] += 1.0;
+
+        m_largest_by_occupancy[k] += p.largestClusterSize();
+    }
+
+    assert(threshold > 0);
+    return threshold;
+}
+
+void PercolationStats::record_clusters(std::size_t trial,
+                                       Percolation<WeightedUF>& p) {
+
+    m_mean_cluster_sizes[trial]     = p.meanClusterSize();
+    m_largest_cluster_sizes[trial]  = p.largestClusterSize();
+    m_spanning_cluster_sizes[trial] = p.spanningClusterSize();
+}
+
 void PercolationStats::run_experiments() {
 
     for (std::size_t i{0}; i < static_cast<std::size_t>(m_num_trials); ++i) {
             
+        int opened{m_method == Method::newman_ziff ? sweep(i) : percolate(i)};
+
         m_percolate_thresholds[i] =
-            percolate() / static_cast<double>(m_grid_size * m_grid_size);
+            opened / static_cast<double>(m_grid_size * m_grid_size);
+    }
+
+    if (m_method != Method::newman_ziff)
+        return;
+
+    // average Newman-Ziff observables over all trials; the largest cluster
+    // size is also normalized to a fraction of all sites
+    double num_sites{static_cast<double>(m_largest_by_occupancy.size() - 1)};
+    for (std::size_t k{0}; k < m_spanning_by_occupancy.size(); ++k) {
+
+        m_spanning_by_occupancy[k] /= m_num_trials;
+        m_largest_by_occupancy[k] /= (m_num_trials * num_sites);
+    }
+}
+
+double PercolationStats::spanningProbability(double p) const {
+
+    assert(m_method == Method::newman_ziff);
+    return convolve(m_spanning_by_occupancy, p);
+}
+
+double PercolationStats::largestClusterFraction(double p) const {
+
+    assert(m_method == Method::newman_ziff);
+    return convolve(m_largest_by_occupancy, p);
+}
+
+double PercolationStats::convolve(const std::vector<double>& observable,
+                                  double p) {
+
+    assert(!observable.empty());
+    assert(p >= 0.0 && p <= 1.0);
+
+    const std::size_t n{observable.size() - 1};
+
+    if (p <= 0.0)
+        return observable.front();
+    if (p >= 1.0)
+        return observable.back();
+
+    // Binomial weights are computed relative to the weight at the most likely
+    // number of open sites, moving outwards via the ratio of successive
+    // weights, until the weights become negligible. Normalizing by the sum of
+    // the weights visited avoids evaluating factorials of large numbers.
+    static constexpr double negligible{1e-16};
+
+    const std::size_t mode{std::min(
+        n, static_cast<std::size_t>(p * static_cast<double>(n + 1)))};
+    const double odds{p / (1.0 - p)};
+
+    double sum_weights{1.0};
+    double sum{observable[mode]};
+
+    double weight{1.0};
+    for (std::size_t k{mode}; k < n && weight > negligible; ++k) {
+
+        weight *= (static_cast<double>(n - k) / static_cast<double>(k + 1)) *
+                  odds;
+        sum_weights += weight;
+        sum += weight * observable[k + 1];
+    }
+
+    weight = 1.0;
+    for (std::size_t k{mode}; k > 0 && weight > negligible; --k) {
+
+        weight *= (static_cast<double>(k) / static_cast<double>(n - k + 1)) /
+                  odds;
+        sum_weights += weight;
+        sum += weight * observable[k - 1];
     }
+
+    return sum / sum_weights;
 }
 
 void PercolationStats::calculate_stats() {                
@@ -106,4 +246,17 @@ void PercolationStats::calculate_stats() {
     double interval{(z * m_stddev) / std::sqrt(m_percolate_thresholds.size())};
     m_confidence_low  = m_mean - interval;
     m_confidence_high = m_mean + interval;
+
+    if (!m_track_clusters)
+        return;
+
+    // average cluster observables over all trials
+    auto average = [](const std::vector<double>& v) {
+        return std::accumulate(v.begin(), v.end(), 0.0) /
+               static_cast<double>(v.size());
+    };
+
+    m_mean_cluster_size     = average(m_mean_cluster_sizes);
+    m_largest_cluster_size  = average(m_largest_cluster_sizes);
+    m_spanning_cluster_size = average(m_spanning_cluster_sizes);
 }
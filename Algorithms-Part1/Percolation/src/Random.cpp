@@ -0,0 +1,62 @@
+/**
+ * \file    Random.cpp
+ * \author  Christine Jones 
+ * \brief   Implementation of uniformly distributed random numbers.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3 
+ */
+
+#include "Random.h"
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <span>
+
+namespace Random {
+
+namespace {
+
+// 64 bits of seed from the operating system's source of randomness
+std::uint64_t deviceSeed() {
+
+    std::random_device rd{};
+    return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+}
+
+}
+
+Xoshiro256 genXoshiro{deviceSeed()};
+
+void getRandomNumbers(int min, int max, std::span<int> numbers) {
+
+    assert(min <= max);
+
+    std::uint32_t range{static_cast<std::uint32_t>(
+                            static_cast<std::int64_t>(max) - min + 1)};
+
+    // local copy of the engine, so its state may be kept in registers
+    Xoshiro256 gen{genXoshiro};
+
+    if (range == 0) {
+
+        for (int& number : numbers)
+            number = static_cast<int>(static_cast<std::int64_t>(min) +
+                                      static_cast<std::uint32_t>(gen() >> 32));
+
+    } else {
+
+        for (int& number : numbers)
+            number = static_cast<int>(static_cast<std::int64_t>(min) +
+                                      boundedNumber(gen, range));
+    }
+
+    genXoshiro = gen;
+}
+
+void seed(std::uint64_t seed_value) {
+
+    genXoshiro.seed(seed_value);
+}
+
+} // namespace Random
@@ -0,0 +1,159 @@
+/**
+ * \file    Relabel.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of the scalar and vectorized relabel kernels and
+ *          runtime selection of the kernel used by relabel().
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Relabel.h"
+#include <cassert>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define RELABEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Relabel {
+
+namespace {
+
+using Kernel = void (*)(int*, std::size_t, int, int);
+
+struct KernelChoice {
+    Kernel      kernel{nullptr};
+    const char* name{nullptr};
+};
+
+KernelChoice selectKernel() {
+
+    if (hasAVX512())
+        return {relabelAVX512, "avx512"};
+
+    if (hasAVX2())
+        return {relabelAVX2, "avx2"};
+
+    return {relabelScalar, "scalar"};
+}
+
+const KernelChoice& chosenKernel() {
+
+    // selected once, on first use
+    static const KernelChoice choice{selectKernel()};
+    return choice;
+}
+
+} // namespace
+
+void relabel(int* ids, std::size_t n, int from, int to) {
+
+    chosenKernel().kernel(ids, n, from, to);
+}
+
+const char* kernelName() {
+
+    return chosenKernel().name;
+}
+
+void relabelScalar(int* ids, std::size_t n, int from, int to) {
+
+    assert(ids != nullptr || n == 0);
+
+    for (std::size_t i{0}; i < n; ++i) {
+        if (ids[i] == from)
+            ids[i] = to;
+    }
+}
+
+#ifdef RELABEL_X86
+
+bool hasAVX2() {
+
+    return __builtin_cpu_supports("avx2");
+}
+
+bool hasAVX512() {
+
+    return __builtin_cpu_supports("avx512f");
+}
+
+__attribute__((target("avx2")))
+void relabelAVX2(int* ids, std::size_t n, int from, int to) {
+
+    assert(ids != nullptr || n == 0);
+
+    const __m256i from_vec{_mm256_set1_epi32(from)};
+    const __m256i to_vec{_mm256_set1_epi32(to)};
+
+    static constexpr std::size_t lanes{8};
+
+    std::size_t i{0};
+    for (; i + lanes <= n; i += lanes) {
+
+        __m256i* ptr{reinterpret_cast<__m256i*>(ids + i)};
+        __m256i  v{_mm256_loadu_si256(ptr)};
+        __m256i  match{_mm256_cmpeq_epi32(v, from_vec)};
+
+        // only write back blocks that contain a matching ID; the common case
+        // is that most blocks do not, which keeps memory traffic read-only
+        if (_mm256_movemask_epi8(match) != 0)
+            _mm256_storeu_si256(ptr, _mm256_blendv_epi8(v, to_vec, match));
+    }
+
+    relabelScalar(ids + i, n - i, from, to);
+}
+
+__attribute__((target("avx512f")))
+void relabelAVX512(int* ids, std::size_t n, int from, int to) {
+
+    assert(ids != nullptr || n == 0);
+
+    const __m512i from_vec{_mm512_set1_epi32(from)};
+    const __m512i to_vec{_mm512_set1_epi32(to)};
+
+    static constexpr std::size_t lanes{16};
+
+    std::size_t i{0};
+    for (; i + lanes <= n; i += lanes) {
+
+        __m512i   v{_mm512_loadu_si512(ids + i)};
+        __mmask16 match{_mm512_cmpeq_epi32_mask(v, from_vec)};
+
+        if (match != 0)
+            _mm512_mask_storeu_epi32(ids + i, match, to_vec);
+    }
+
+    // remaining IDs handled with a single masked load/store
+    if (i < n) {
+
+        __mmask16 tail{static_cast<__mmask16>((1u << (n - i)) - 1u)};
+        __m512i   v{_mm512_maskz_loadu_epi32(tail, ids + i)};
+        __mmask16 match{_mm512_mask_cmpeq_epi32_mask(tail, v, from_vec)};
+
+        if (match != 0)
+            _mm512_mask_storeu_epi32(ids + i, match, to_vec);
+    }
+}
+
+#else // !RELABEL_X86
+
+bool hasAVX2()   { return false; }
+bool hasAVX512() { return false; }
+
+// vectorized kernels are unavailable; fall back to the scalar kernel
+void relabelAVX2(int* ids, std::size_t n, int from, int to) {
+
+    relabelScalar(ids, n, from, to);
+}
+
+void relabelAVX512(int* ids, std::size_t n, int from, int to) {
+
+    relabelScalar(ids, n, from, to);
+}
+
+#endif // RELABEL_X86
+
+} // namespace Relabel
@@ -8,19 +8,21 @@
  */
 
 #include "UnionFind.h"
+#include "Relabel.h"
 #include <iostream>
 #include <numeric>
 #include <sstream>
 #include <string>
 
-UnionFind::UnionFind(int n):
-    m_object_ids{std::vector<int>(static_cast<std::size_t>(n))}
+UnionFind::UnionFind(int n, Memory memory):
+    m_object_ids{Array(static_cast<std::size_t>(n), allocator(memory))}
 {
     assert(n > 0);
 }
 
-UnionFind::UnionFind(int n, int initial_value):
-    m_object_ids{std::vector<int>(static_cast<std::size_t>(n), initial_value)}
+UnionFind::UnionFind(int n, int initial_value, Memory memory):
+    m_object_ids{
+        Array(static_cast<std::size_t>(n), initial_value, allocator(memory))}
 {
     assert(n > 0);
 }
@@ -45,14 +47,14 @@ bool UnionFind::isValidIndex(int i) const {
     return i >= 0 && static_cast<std::size_t>(i) < m_object_ids.size();
 }
 
-QuickUF::QuickUF(int n):
-    UnionFind(n)
+QuickUF::QuickUF(int n, Memory memory):
+    UnionFind(n, memory)
 {
     std::iota(m_object_ids.begin(), m_object_ids.end(), 0);
 }
 
-QuickUF::QuickUF(int n, int initial_value):
-    UnionFind(n, initial_value)
+QuickUF::QuickUF(int n, int initial_value, Memory memory):
+    UnionFind(n, initial_value, memory)
 {}
 
 bool QuickUF::connected(int p, int q) {
@@ -71,25 +73,26 @@ void QuickUF::join(int p, int q) {
     int pid = m_object_ids[static_cast<std::size_t>(p)];
     int qid = m_object_ids[static_cast<std::size_t>(q)];
 
+    // objects already joined
+    if (pid == qid)
+        return;
+
     // joining object p, and all other connected objects, to object q
-    for (std::size_t i{0}; i < m_object_ids.size(); ++i) {
-        if (m_object_ids[i] == pid)
-            m_object_ids[i] = qid;
-    }
+    Relabel::relabel(m_object_ids.data(), m_object_ids.size(), pid, qid);
 }
 
-WeightedUF::WeightedUF(int n):
-    UnionFind{n},
-    m_tree_sizes{
-        std::vector<int>(static_cast<std::size_t>(n), initial_tree_size)}
+WeightedUF::WeightedUF(int n, Memory memory):
+    UnionFind{n, memory},
+    m_tree_sizes{Array(static_cast<std::size_t>(n), initial_tree_size,
+                       allocator(memory))}
 {
     std::iota(m_object_ids.begin(), m_object_ids.end(), 0);
 }
 
-WeightedUF::WeightedUF(int n, int initial_value):
-    UnionFind{n, initial_value},
-    m_tree_sizes{
-        std::vector<int>(static_cast<std::size_t>(n), initial_tree_size)}
+WeightedUF::WeightedUF(int n, int initial_value, Memory memory):
+    UnionFind{n, initial_value, memory},
+    m_tree_sizes{Array(static_cast<std::size_t>(n), initial_tree_size,
+                       allocator(memory))}
 {}
 
 bool WeightedUF::connected(int p, int q) {
@@ -128,6 +131,14 @@ void WeightedUF::join(int p, int q) {
     }
 }
 
+int WeightedUF::size(int p) {
+
+    assert(isValidIndex(p));
+
+    // tree size is only maintained at the root of each tree
+    return m_tree_sizes[static_cast<std::size_t>(root(p))];
+}
+
 std::string WeightedUF::toStr() const {
 
     assert(m_object_ids.size() == m_tree_sizes.size());
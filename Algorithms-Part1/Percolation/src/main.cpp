@@ -11,36 +11,97 @@
 #include "Percolation.h"
 #include "StopWatch.h"
 #include "UnionFind.h"
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 void printUsage() {
 
-    std::cout << "Usage: <program name> <n> <T>" << '\n';
+    std::cout << "Usage: <program name> [-c] [-s <m>] <n> <T>" << '\n';
+    std::cout << "\t-c = report cluster observables at the threshold" << '\n';
+    std::cout << "\t-s = run Newman-Ziff sweeps; report observables at m + 1"
+              << " evenly spaced\n\t     probabilities p in [0, 1]" << '\n';
     std::cout << "\tn = grid size, n-by-n grid" << '\n';
     std::cout << "\tT = # independent computational experiments" << '\n';
 }
 
+/**
+ * Print the Newman-Ziff observables, spanning probability and largest
+ * cluster fraction, at the given number of evenly spaced probabilities.
+ */
+void printSweep(const PercolationStats& p, int m) {
+
+    std::cout << "           p   spanning    largest" << '\n';
+    for (int i{0}; i <= m; ++i) {
+
+        double prob{static_cast<double>(i) / m};
+        std::cout << std::fixed << std::setprecision(4)
+                  << std::setw(12) << prob
+                  << std::setw(11) << p.spanningProbability(prob)
+                  << std::setw(11) << p.largestClusterFraction(prob) << '\n';
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
 /**
  * Main program. Runs the given number of experiments using the given size
  * percolation system, and reports the resulting percolation threshold.
  * 
- * Usage: <program name> <n> <T>
+ * Optionally, cluster observables (mean cluster size, largest cluster size,
+ * spanning cluster mass) at the percolation threshold are also reported.
+ *
+ * Optionally, experiments are run as Newman-Ziff sweeps, and the spanning
+ * probability and largest cluster fraction are reported for a range of
+ * probabilities that a site is open.
+ * 
+ * Usage: <program name> [-c] [-s <m>] <n> <T>
+ *     -c = report cluster observables at the threshold
+ *     -s = run Newman-Ziff sweeps; report observables at m + 1 evenly spaced
+ *          probabilities p in [0, 1]
  *      n = grid size, n-by-n grid
  *      T = # independent computational experiments
  * 
  */
 int main(int argc, char* argv[]) {
 
-    if (argc != 3) {
+    bool track_clusters{false};
+    int  sweep_points{0};
+
+    int arg{1};
+    for (; arg < argc && argv[arg][0] == '-'; ++arg) {
+
+        std::string_view option{argv[arg]};
+
+        if (option == "-c") {
+
+            track_clusters = true;
+
+        } else if (option == "-s" && arg + 1 < argc) {
+
+            std::stringstream ss{argv[++arg]};
+            if (!(ss >> sweep_points) || sweep_points <= 0) {
+
+                printUsage();
+                return 1;
+            }
+
+        } else {
+
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (argc - arg != 2) {
 
         printUsage();
         return 1;        
     }
 
-    std::stringstream ssarg1{argv[1]};
-    std::stringstream ssarg2{argv[2]};
+    std::stringstream ssarg1{argv[arg]};
+    std::stringstream ssarg2{argv[arg + 1]};
 
     int grid_size{};
     int num_trials{};
@@ -55,7 +116,10 @@ int main(int argc, char* argv[]) {
     StopWatch timer{};
 
     // run experiments
-    PercolationStats p{grid_size, num_trials};
+    PercolationStats p{grid_size, num_trials, track_clusters,
+                       sweep_points > 0 ?
+                           PercolationStats::Method::newman_ziff :
+                           PercolationStats::Method::threshold};
     
     // record elapsed time of experiments
     double elapsed_time{timer.elapsed()};
@@ -65,6 +129,17 @@ int main(int argc, char* argv[]) {
     std::cout << "95% interval = ["
               << p.confidenceLow() << ", "
               << p.confidenceHigh() << "]\n";
+
+    if (p.tracksClusters()) {
+
+        std::cout << "mean cluster = " << p.meanClusterSize() << '\n';
+        std::cout << " max cluster = " << p.largestClusterSize() << '\n';
+        std::cout << "span cluster = " << p.spanningClusterSize() << '\n';
+    }
+
+    if (p.method() == PercolationStats::Method::newman_ziff)
+        printSweep(p, sweep_points);
+
     std::cout << "elapsed time = " << elapsed_time << " seconds" << '\n';
 
     return 0;
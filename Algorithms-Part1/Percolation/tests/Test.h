@@ -13,10 +13,14 @@
 #include <string_view>
 
 void testPercolation();
+void testPercolationClusters();
+void testPercolationSweep();
 void testQuickUF();
 void testOpenQuickUF();
+void testQuickUFRelabel();
 void testWeightedUF();
 void testOpenWeightedUF();
+void testPageAllocator();
 
 namespace Test {
 
@@ -15,10 +15,14 @@ int main() {
 
     std::cout << "Running Tests..." << '\n' << '\n';
     testPercolation();
+    testPercolationClusters();
+    testPercolationSweep();
     testQuickUF();
     testOpenQuickUF();
+    testQuickUFRelabel();
     testWeightedUF();
     testOpenWeightedUF();
+    testPageAllocator();
     std::cout << '\n' << "COMPLETE" << '\n';
 
     return 0;
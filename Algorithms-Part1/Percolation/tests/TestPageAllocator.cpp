@@ -0,0 +1,74 @@
+/**
+ * \file    TestPageAllocator.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for PageAllocator class and huge page UnionFind storage.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "PageAllocator.h"
+#include "UnionFind.h"
+#include "Test.h"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+void testPageAllocator() {
+
+    Test::reset();
+
+    std::cout << "***** Page Allocator *****" << '\n';
+
+    constexpr std::size_t page{PageAllocator<int>::huge_page_size};
+
+    PageAllocator<int> standard{};
+    PageAllocator<int> huge{true};
+
+    Test::ASSERT(!standard.usesHugePages() && huge.usesHugePages(),
+                 "PageAllocator: mode"); // #1
+    Test::ASSERT(!(standard == huge), "PageAllocator: not equal"); // #2
+
+    // large allocations are aligned to the huge page size
+    std::size_t large{(3 * page) / sizeof(int)};
+    int* ptr{huge.allocate(large)};
+    bool aligned{reinterpret_cast<std::uintptr_t>(ptr) % page == 0};
+    ptr[0] = 1;
+    ptr[large - 1] = 2;
+    huge.deallocate(ptr, large);
+    Test::ASSERT(aligned, "PageAllocator: huge page aligned"); // #3
+
+    // small allocations fall back to operator new
+    int* small{huge.allocate(16)};
+    small[15] = 3;
+    huge.deallocate(small, 16);
+    Test::ASSERT(small != nullptr, "PageAllocator: small allocation"); // #4
+
+    std::vector<int, PageAllocator<int>> v(large, 7, huge);
+    Test::ASSERT(v.size() == large && v.front() == 7 && v.back() == 7,
+                 "PageAllocator: vector storage"); // #5
+
+    // UnionFind behaves identically regardless of memory used
+    constexpr int n{1 << 20};
+    WeightedUF a{n};
+    WeightedUF b{n, UnionFind::Memory::huge_pages};
+    OpenUF<WeightedUF> c{n, UnionFind::Memory::huge_pages};
+
+    for (int i{0}; i + 3 < n; i += 3) {
+        a.join(i, i + 3);
+        b.join(i, i + 3);
+        c.open(i);
+        c.open(i + 3);
+        c.join(i, i + 3);
+    }
+
+    Test::ASSERT(a.connected(0, n - 4) && b.connected(0, n - 4) &&
+                 c.connected(0, n - 4), "PageAllocator: UF connected"); // #6
+    Test::ASSERT(!b.connected(1, 4) && !c.connected(1, 4),
+                 "PageAllocator: UF not connected"); // #7
+    Test::ASSERT(a.size(0) == b.size(0) && b.size(0) == c.size(0),
+                 "PageAllocator: UF component size"); // #8
+
+    Test::runReport();
+    std::cout << "**************************" << '\n' << '\n';
+}
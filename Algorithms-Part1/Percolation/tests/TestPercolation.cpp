@@ -9,8 +9,12 @@
 
 #include "Percolation.h"
 #include "Test.h"
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <random>
 #include <string>
+#include <vector>
 
 void testPercolation() {
 
@@ -74,3 +78,189 @@ Number of Open Sites: 16\n\
     Test::runReport();
     std::cout << "***********************" << '\n' << '\n';
 }
+
+namespace {
+
+/**
+ * Cluster observables computed by a flood fill over the open sites of a
+ * percolation system; used to verify the incrementally tracked observables.
+ */
+struct FloodFillClusters {
+    int       num_clusters{0};
+    int       largest{0};
+    int       spanning{0};
+    long long sum_squares{0};
+};
+
+template <typename UF>
+FloodFillClusters floodFill(const Percolation<UF>& p, int n) {
+
+    FloodFillClusters result{};
+    std::vector<bool> visited(static_cast<std::size_t>(n * n), false);
+
+    for (int start{0}; start < n * n; ++start) {
+
+        if (visited[static_cast<std::size_t>(start)] ||
+            !p.isOpen((start / n) + 1, (start % n) + 1))
+            continue;
+
+        int  size{0};
+        bool top{false};
+        bool bottom{false};
+
+        std::vector<int> stack{start};
+        visited[static_cast<std::size_t>(start)] = true;
+
+        while (!stack.empty()) {
+
+            int site{stack.back()};
+            stack.pop_back();
+
+            int row{site / n};
+            int col{site % n};
+            ++size;
+            top    = top || (row == 0);
+            bottom = bottom || (row == n - 1);
+
+            const int neighbors[4][2]{{row - 1, col}, {row + 1, col},
+                                      {row, col - 1}, {row, col + 1}};
+            for (const auto& nb : neighbors) {
+
+                if (nb[0] < 0 || nb[0] >= n || nb[1] < 0 || nb[1] >= n)
+                    continue;
+
+                int next{(nb[0] * n) + nb[1]};
+                if (visited[static_cast<std::size_t>(next)] ||
+                    !p.isOpen(nb[0] + 1, nb[1] + 1))
+                    continue;
+
+                visited[static_cast<std::size_t>(next)] = true;
+                stack.push_back(next);
+            }
+        }
+
+        ++result.num_clusters;
+        result.largest = std::max(result.largest, size);
+        result.sum_squares += static_cast<long long>(size) * size;
+        if (top && bottom)
+            result.spanning = size;
+    }
+
+    return result;
+}
+
+}
+
+void testPercolationClusters() {
+
+    Test::reset();
+
+    std::cout << "***** Percolation Clusters *****" << '\n';
+    Percolation<WeightedUF> p(5, true);
+
+    Test::ASSERT(p.tracksClusters(), "Clusters: tracked"); // #1
+    Test::ASSERT(p.numberOfClusters() == 0, "Clusters: none"); // #2
+
+    p.open(1, 1);
+    p.open(1, 2);
+    p.open(3, 3);
+    p.open(5, 5);
+    p.open(1, 4);
+    p.open(1, 4); // repeat
+
+    // top row sites connect via virtual top, but are separate clusters
+    Test::ASSERT(p.numberOfClusters() == 4, "Clusters: count"); // #3
+    Test::ASSERT(p.largestClusterSize() == 2, "Clusters: largest"); // #4
+    Test::ASSERT(p.spanningClusterSize() == 0, "Clusters: no spanning"); // #5
+    Test::ASSERT(p.meanClusterSize() == 7.0 / 5.0, "Clusters: mean"); // #6
+
+    p.open(2, 2);
+    p.open(3, 2);
+    p.open(4, 2);
+    p.open(5, 2);
+
+    Test::ASSERT(p.percolates(), "Clusters: percolates"); // #7
+    Test::ASSERT(p.numberOfClusters() == 3, "Clusters: count"); // #8
+    Test::ASSERT(p.largestClusterSize() == 7, "Clusters: largest"); // #9
+    Test::ASSERT(p.spanningClusterSize() == 7, "Clusters: spanning"); // #10
+    Test::ASSERT(p.meanClusterSize() == 1.0, "Clusters: mean"); // #11
+
+    // compare tracked observables against a flood fill at the threshold
+    std::mt19937 gen{2024};
+    bool match{true};
+
+    for (int trial{0}; trial < 20; ++trial) {
+
+        static constexpr int n{20};
+        Percolation<WeightedUF> q(n, true);
+        std::uniform_int_distribution<int> dist{1, n};
+
+        while (!q.percolates())
+            q.open(dist(gen), dist(gen));
+
+        FloodFillClusters expected{floodFill(q, n)};
+        double mean{
+            static_cast<double>(expected.sum_squares -
+                static_cast<long long>(expected.spanning) * expected.spanning) /
+            (q.numberOfOpenSites() - expected.spanning)};
+
+        match = match &&
+                q.numberOfClusters() == expected.num_clusters &&
+                q.largestClusterSize() == expected.largest &&
+                q.spanningClusterSize() == expected.spanning &&
+                q.meanClusterSize() == mean;
+    }
+    Test::ASSERT(match, "Clusters: flood fill comparison"); // #12
+
+    PercolationStats stats(20, 10, true);
+    Test::ASSERT(stats.tracksClusters() &&
+                 stats.spanningClusterSize() > 0.0 &&
+                 stats.largestClusterSize() >= stats.spanningClusterSize() &&
+                 stats.meanClusterSize() > 0.0,
+                 "Clusters: stats"); // #13
+
+    Test::runReport();
+    std::cout << "********************************" << '\n' << '\n';
+}
+
+void testPercolationSweep() {
+
+    Test::reset();
+
+    std::cout << "***** Percolation Newman-Ziff *****" << '\n';
+    PercolationStats stats(20, 200, true,
+                           PercolationStats::Method::newman_ziff);
+
+    Test::ASSERT(stats.method() == PercolationStats::Method::newman_ziff,
+                 "Newman-Ziff: method"); // #1
+    Test::ASSERT(stats.spanningByOccupancy().size() == 401 &&
+                 stats.largestByOccupancy().size() == 401,
+                 "Newman-Ziff: observables per occupancy"); // #2
+    Test::ASSERT(stats.spanningProbability(0.0) == 0.0 &&
+                 stats.spanningProbability(1.0) == 1.0,
+                 "Newman-Ziff: spanning probability bounds"); // #3
+    Test::ASSERT(stats.largestClusterFraction(0.0) == 0.0 &&
+                 stats.largestClusterFraction(1.0) == 1.0,
+                 "Newman-Ziff: largest cluster bounds"); // #4
+
+    bool monotonic{true};
+    double previous{0.0};
+    for (int i{0}; i <= 100; ++i) {
+
+        double spanning{stats.spanningProbability(i / 100.0)};
+        monotonic = monotonic && (spanning >= previous - 1e-12);
+        previous = spanning;
+    }
+    Test::ASSERT(monotonic, "Newman-Ziff: spanning monotonic"); // #5
+
+    double near_threshold{stats.spanningProbability(0.593)};
+    Test::ASSERT(near_threshold > 0.25 && near_threshold < 0.75,
+                 "Newman-Ziff: spanning near threshold"); // #6
+    Test::ASSERT(stats.mean() > 0.55 && stats.mean() < 0.65,
+                 "Newman-Ziff: threshold mean"); // #7
+    Test::ASSERT(stats.spanningClusterSize() > 0.0,
+                 "Newman-Ziff: cluster observables"); // #8
+
+    Test::runReport();
+    std::cout << "***********************************" << '\n' << '\n';
+}
@@ -7,9 +7,12 @@
  * \license   GNU GENERAL PUBLIC LICENSE version 3 
  */
 
+#include "Relabel.h"
 #include "UnionFind.h"
 #include "Test.h"
+#include <cstddef>
 #include <iostream>
+#include <vector>
 
 void testQuickUF() {
 
@@ -90,3 +93,60 @@ void testOpenQuickUF() {
     Test::runReport();
     std::cout << "*********************************" << '\n' << '\n';
 }
+
+void testQuickUFRelabel() {
+
+    Test::reset();
+
+    std::cout << "***** Quick Union Find Relabel *****" << '\n';
+    std::cout << "selected kernel: " << Relabel::kernelName() << '\n';
+
+    // array lengths chosen to exercise full vector blocks and partial tails
+    std::vector<std::size_t> lengths{0, 1, 7, 8, 9, 15, 16, 17, 33, 1000, 1003};
+
+    bool scalar_valid{true};
+    bool avx2_match{true};
+    bool avx512_match{true};
+    bool dispatch_match{true};
+
+    for (std::size_t n : lengths) {
+
+        std::vector<int> input(n);
+        for (std::size_t i{0}; i < n; ++i)
+            input[i] = static_cast<int>((i * 7) % 5);
+
+        std::vector<int> expected{input};
+        for (int& id : expected) {
+            if (id == 3)
+                id = 42;
+        }
+
+        std::vector<int> scalar{input};
+        Relabel::relabelScalar(scalar.data(), n, 3, 42);
+        scalar_valid = scalar_valid && (scalar == expected);
+
+        if (Relabel::hasAVX2()) {
+            std::vector<int> avx2{input};
+            Relabel::relabelAVX2(avx2.data(), n, 3, 42);
+            avx2_match = avx2_match && (avx2 == expected);
+        }
+
+        if (Relabel::hasAVX512()) {
+            std::vector<int> avx512{input};
+            Relabel::relabelAVX512(avx512.data(), n, 3, 42);
+            avx512_match = avx512_match && (avx512 == expected);
+        }
+
+        std::vector<int> dispatch{input};
+        Relabel::relabel(dispatch.data(), n, 3, 42);
+        dispatch_match = dispatch_match && (dispatch == expected);
+    }
+
+    Test::ASSERT(scalar_valid, "Relabel: scalar kernel"); // #1
+    Test::ASSERT(avx2_match, "Relabel: avx2 kernel"); // #2
+    Test::ASSERT(avx512_match, "Relabel: avx512 kernel"); // #3
+    Test::ASSERT(dispatch_match, "Relabel: dispatched kernel"); // #4
+
+    Test::runReport();
+    std::cout << "************************************" << '\n' << '\n';
+}
@@ -42,6 +42,14 @@ void testWeightedUF() {
     Test::ASSERT((uf.toStr() == validUF),
                   "WeightedUF: string compare"); // #6
 
+    Test::ASSERT(uf.size(0) == 10, "WeightedUF: component size"); // #7
+
+    WeightedUF sizes{6};
+    sizes.join(0, 1);
+    sizes.join(2, 1);
+    Test::ASSERT(sizes.size(2) == 3, "WeightedUF: component size"); // #8
+    Test::ASSERT(sizes.size(5) == 1, "WeightedUF: component size"); // #9
+
     Test::runReport();
     std::cout << "*******************************" << '\n' << '\n';
 }
@@ -92,6 +100,13 @@ void testOpenWeightedUF() {
     Test::ASSERT((uf.toStr() == validUF),
                   "OpenWeightedUF: string compare"); // #9
 
+    OpenUF<WeightedUF> sizes{4};
+    sizes.open(1);
+    sizes.open(2);
+    sizes.join(1, 2);
+    Test::ASSERT(sizes.size(1) == 2, "OpenWeightedUF: component size"); // #10
+    Test::ASSERT(sizes.size(3) == 0, "OpenWeightedUF: blocked size"); // #11
+
     Test::runReport();
     std::cout << "************************************" << '\n' << '\n';
 }
@@ -0,0 +1,131 @@
+/**
+ * \file    Bench.cpp
+ * \author  Christine Jones
+ * \brief   Bench namespace; utilities to facilitate micro-benchmarking.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Bench {
+
+namespace {
+
+struct Result {
+    std::string name{};
+    long long   n{};
+    double      ns_per_op{};
+};
+
+std::vector<Result> results{};
+std::string         name_filter{};
+
+}
+
+bool selected(std::string_view name) {
+
+    return name.find(name_filter) != std::string_view::npos;
+}
+
+void setFilter(std::string_view filter) {
+
+    name_filter = filter;
+}
+
+void record(std::string_view name, long long n, long long ops,
+            double seconds, double reference_seconds) {
+
+    double ns_per_op{(seconds * 1e9) / static_cast<double>(ops)};
+    results.push_back(Result{std::string{name}, n, ns_per_op});
+
+    std::cout << std::left << std::setw(36) << name << std::right
+              << std::setw(12) << n
+              << std::setw(14) << std::fixed << std::setprecision(3)
+              << ns_per_op << " ns/op";
+
+    if (reference_seconds > 0.0)
+        std::cout << std::setw(10) << std::setprecision(2)
+                  << reference_seconds / seconds << "x";
+
+    std::cout << std::defaultfloat << '\n';
+}
+
+bool writeResults(const std::string& filename) {
+
+    std::ofstream out{filename};
+    if (!out)
+        return false;
+
+    out << "name,n,ns_per_op" << '\n';
+    for (const Result& r : results)
+        out << r.name << ',' << r.n << ',' << std::setprecision(9)
+            << r.ns_per_op << '\n';
+
+    return static_cast<bool>(out);
+}
+
+int compareBaseline(const std::string& filename, double tolerance) {
+
+    std::ifstream in{filename};
+    if (!in)
+        return -1;
+
+    // baseline results keyed by benchmark name and problem size
+    std::map<std::pair<std::string, long long>, double> baseline{};
+
+    std::string line{};
+    std::getline(in, line); // header
+    while (std::getline(in, line)) {
+
+        std::stringstream ss{line};
+        std::string name{};
+        std::string n{};
+        std::string ns_per_op{};
+
+        if (std::getline(ss, name, ',') && std::getline(ss, n, ',') &&
+            std::getline(ss, ns_per_op))
+            baseline[{name, std::stoll(n)}] = std::stod(ns_per_op);
+    }
+
+    std::cout << "***** Baseline Comparison (tolerance "
+              << tolerance * 100.0 << "%) *****" << '\n';
+
+    int regressions{0};
+    for (const Result& r : results) {
+
+        auto found{baseline.find({r.name, r.n})};
+
+        std::cout << std::left << std::setw(36) << r.name << std::right
+                  << std::setw(12) << r.n;
+
+        if (found == baseline.end()) {
+
+            std::cout << "   no baseline" << '\n';
+            continue;
+        }
+
+        double change{(r.ns_per_op / found->second) - 1.0};
+        bool   regressed{change > tolerance};
+        regressions += regressed ? 1 : 0;
+
+        std::cout << std::setw(12) << std::fixed << std::setprecision(1)
+                  << std::showpos << change * 100.0 << '%' << std::noshowpos
+                  << (regressed ? "   REGRESSED" : "   ok")
+                  << std::defaultfloat << '\n';
+    }
+
+    return regressions;
+}
+
+}
@@ -0,0 +1,130 @@
+/**
+ * \file    Bench.h
+ * \author  Christine Jones
+ * \brief   Bench namespace; utilities to facilitate micro-benchmarking.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "StopWatch.h"
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+void benchRandom();
+void benchDeque();
+void benchMonotonicDeque();
+void benchMinMaxHeap();
+void benchRandomQueue();
+void benchConcurrentQueues();
+void benchScheduler();
+void benchWords();
+
+namespace Bench {
+
+// last result consumed; volatile, so that every store to it is kept
+inline volatile long long sink{0};
+
+/**
+ * Consume a result, so that the compiler cannot discard the work that
+ * produced it.
+ */
+inline void consume(long long result) { sink = result; }
+
+/**
+ * Repeatedly call the given function until at least the given minimum time
+ * has elapsed, and return the average elapsed time per call in seconds. The
+ * measurement is repeated the given number of times, and the fastest average
+ * is returned to reduce the effect of noise on the result.
+ */
+template <typename F>
+double measure(F&& func, double min_seconds = 0.2, int repetitions = 3) {
+
+    // warm up caches, and the branch predictor, before timing
+    func();
+
+    double best{0.0};
+    for (int r{0}; r < repetitions; ++r) {
+
+        long long calls{0};
+        StopWatch timer{};
+        double elapsed{0.0};
+        do {
+            func();
+            ++calls;
+            elapsed = timer.elapsed();
+        } while (elapsed < min_seconds);
+
+        double average{elapsed / static_cast<double>(calls)};
+        best = (r == 0) ? average : std::min(best, average);
+    }
+
+    return best;
+}
+
+/**
+ * Determine if the named benchmark is selected to run, i.e., its name
+ * contains the filter given on the command line.
+ */
+bool selected(std::string_view name);
+
+/**
+ * Run the named benchmark, if selected: measure the given function, then
+ * record and print the result. The result is reported as time per operation,
+ * where each call of the function performs the given number of operations.
+ * A speedup relative to a reference time per call is printed if given.
+ *
+ * \return double Time per call in seconds; zero if not selected.
+ */
+template <typename F>
+double run(std::string_view name, long long n, long long ops, F&& func,
+           double reference_seconds = 0.0);
+
+/**
+ * Record and print a single benchmark result.
+ */
+void record(std::string_view name, long long n, long long ops,
+            double seconds, double reference_seconds = 0.0);
+
+/**
+ * Command line configuration; see BenchMain.cpp.
+ */
+void setFilter(std::string_view filter);
+
+/**
+ * Write all recorded results as CSV to the given file: name, n, ns per op.
+ *
+ * \return bool True if written successfully; False otherwise.
+ */
+bool writeResults(const std::string& filename);
+
+/**
+ * Compare all recorded results against the results in the given baseline
+ * CSV file. A result regresses if its time per operation exceeds the
+ * baseline by more than the given tolerance, e.g., 0.10 for 10%. Results
+ * without a baseline are reported but do not fail the comparison.
+ *
+ * \return int Number of regressed results; -1 if the baseline is unreadable.
+ */
+int compareBaseline(const std::string& filename, double tolerance);
+
+template <typename F>
+double run(std::string_view name, long long n, long long ops, F&& func,
+           double reference_seconds) {
+
+    if (!selected(name))
+        return 0.0;
+
+    double seconds{measure(func)};
+    record(name, n, ops, seconds, reference_seconds);
+
+    return seconds;
+}
+
+}
+
+#endif // BENCH_H
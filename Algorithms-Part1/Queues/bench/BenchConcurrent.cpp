@@ -0,0 +1,214 @@
+/**
+ * \file    BenchConcurrent.cpp
+ * \author  Christine Jones
+ * \brief   Throughput benchmarks of the concurrent queues against a Deque
+ *          guarded by a mutex, across thread counts.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "ConcurrentRandomQueue.h"
+#include "Deque.h"
+#include "MPMCQueue.h"
+#include "RandomQueue.h"
+#include "SPSCQueue.h"
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// number of objects passed from producers to consumers per benchmark
+constexpr int num_items{1'000'000};
+
+// capacity of the bounded queues
+constexpr int queue_capacity{1'024};
+
+/**
+ * Deque guarded by a mutex; the way a Deque is shared between threads
+ * without a concurrent queue.
+ */
+class LockedDeque {
+
+public:
+
+    bool tryEnqueue(int item) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_deque.addLast(item);
+        return true;
+    }
+
+    std::optional<int> tryDequeue() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_deque.isEmpty())
+            return std::nullopt;
+        return m_deque.removeFirst();
+    }
+
+private:
+
+    std::mutex m_mutex{};
+    Deque<int> m_deque{};
+
+};
+
+/**
+ * RandomQueue guarded by a mutex; the way a RandomQueue is shared between
+ * threads without ConcurrentRandomQueue.
+ */
+class LockedRandomQueue {
+
+public:
+
+    bool tryEnqueue(int item) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_queue.enqueue(item);
+        return true;
+    }
+
+    std::optional<int> tryDequeue() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_queue.isEmpty())
+            return std::nullopt;
+        return m_queue.dequeue();
+    }
+
+private:
+
+    std::mutex       m_mutex{};
+    RandomQueue<int> m_queue{};
+
+};
+
+/**
+ * ConcurrentRandomQueue, with the interface of the bounded queues; it is
+ * never full.
+ */
+class ShardedRandomQueue {
+
+public:
+
+    bool tryEnqueue(int item) {
+        m_queue.enqueue(item);
+        return true;
+    }
+
+    std::optional<int> tryDequeue() { return m_queue.tryDequeue(); }
+
+private:
+
+    ConcurrentRandomQueue<int> m_queue{};
+
+};
+
+/**
+ * Pass num_items objects from the given number of producer threads to the
+ * given number of consumer threads through a new queue. Threads yield when
+ * the queue is full or empty, so that results remain meaningful when there
+ * are more threads than processors.
+ */
+template <typename Q, typename... Args>
+void transfer(int producers, int consumers, Args... args) {
+
+    Q q{args...};
+    std::atomic<int> consumed{0};
+    std::atomic<long long> sum{0};
+
+    std::vector<std::thread> threads{};
+
+    for (int p{0}; p < producers; ++p) {
+        threads.emplace_back([&q, p, producers]() {
+            for (int i{p}; i < num_items; i += producers) {
+                while (!q.tryEnqueue(i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int c{0}; c < consumers; ++c) {
+        threads.emplace_back([&q, &consumed, &sum]() {
+            long long local_sum{0};
+            while (consumed.load(std::memory_order_relaxed) < num_items) {
+                std::optional<int> item{q.tryDequeue()};
+                if (!item) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                local_sum += *item;
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+            sum += local_sum;
+        });
+    }
+
+    for (std::thread& t : threads)
+        t.join();
+
+    Bench::consume(sum);
+}
+
+std::string config(int producers, int consumers) {
+
+    return std::to_string(producers) + "x" + std::to_string(consumers);
+}
+
+}
+
+void benchConcurrentQueues() {
+
+    std::cout << "***** Concurrent Queues *****" << '\n';
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+              << '\n';
+
+    // speedups are reported relative to the locked deque of the same
+    // thread counts
+    double locked{Bench::run("concurrent/locked/1x1", num_items, num_items,
+                             []() { transfer<LockedDeque>(1, 1); })};
+
+    Bench::run("concurrent/spsc/1x1", num_items, num_items, []() {
+        transfer<SPSCQueue<int>>(1, 1, queue_capacity);
+    }, locked);
+
+    Bench::run("concurrent/mpmc/1x1", num_items, num_items, []() {
+        transfer<MPMCQueue<int>>(1, 1, queue_capacity);
+    }, locked);
+
+    for (int threads : {2, 4}) {
+
+        std::string name{config(threads, threads)};
+
+        locked = Bench::run("concurrent/locked/" + name, num_items, num_items,
+                            [threads]() {
+            transfer<LockedDeque>(threads, threads);
+        });
+
+        Bench::run("concurrent/mpmc/" + name, num_items, num_items,
+                   [threads]() {
+            transfer<MPMCQueue<int>>(threads, threads, queue_capacity);
+        }, locked);
+    }
+
+    // randomized queues; speedups are relative to the locked RandomQueue
+    for (int threads : {1, 2, 4}) {
+
+        std::string name{config(threads, threads)};
+
+        locked = Bench::run("concurrent/rq-locked/" + name, num_items,
+                            num_items, [threads]() {
+            transfer<LockedRandomQueue>(threads, threads);
+        });
+
+        Bench::run("concurrent/rq-sharded/" + name, num_items, num_items,
+                   [threads]() {
+            transfer<ShardedRandomQueue>(threads, threads);
+        }, locked);
+    }
+
+    std::cout << "*****************************" << '\n' << '\n';
+}
@@ -0,0 +1,341 @@
+/**
+ * \file    BenchDeque.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of the block-based Deque against the original linked
+ *          list implementation and std::deque.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "Deque.h"
+#include "LinkedDeque.h"
+#include "PoolAllocator.h"
+#include "StaticDeque.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>      // for std::as_const
+#include <vector>
+
+namespace {
+
+// number of operations per benchmark
+constexpr int num_ops{10'000'000};
+
+// number of objects held by the deque in the steady state benchmark
+constexpr int steady_size{1'000};
+
+// number of objects added, then removed, by each burst of the burst benchmark
+constexpr int burst_size{100'000};
+
+// number of indexed lookups, and binary searches, per benchmark
+constexpr int lookups{100'000};
+
+// number of polls of a deque that is mostly empty, and the interval at which
+// an object is added
+constexpr int polls{100'000};
+constexpr int poll_interval{4};
+
+/**
+ * Adapts std::deque to the Deque interface.
+ */
+template <typename T>
+class StdDeque {
+
+public:
+
+    bool isEmpty() const { return m_deque.empty(); }
+    int size() const { return static_cast<int>(m_deque.size()); }
+
+    void addFirst(const T& item) { m_deque.push_front(item); }
+    void addLast(const T& item)  { m_deque.push_back(item); }
+
+    T removeFirst()
+        { T item{m_deque.front()}; m_deque.pop_front(); return item; }
+    T removeLast()
+        { T item{m_deque.back()}; m_deque.pop_back(); return item; }
+
+    void clear() { m_deque.clear(); }
+
+    auto begin() const { return m_deque.begin(); }
+    auto end() const   { return m_deque.end(); }
+
+private:
+
+    std::deque<T> m_deque{};
+
+};
+
+// time per call of each workload: queue, stack, steady, burst, iterate
+using Times = std::array<double, 5>;
+
+template <typename D>
+Times benchImplementation(const std::string& impl, const Times& reference) {
+
+    std::string prefix{"deque/" + impl + "/"};
+    Times times{};
+
+    // FIFO queue: add at the back, remove from the front
+    times[0] = Bench::run(prefix + "queue", num_ops, 2LL * num_ops, []() {
+        D d{};
+        long long sum{0};
+        for (int i{0}; i < num_ops; ++i)
+            d.addLast(i);
+        for (int i{0}; i < num_ops; ++i)
+            sum += d.removeFirst();
+        Bench::consume(sum);
+    }, reference[0]);
+
+    // LIFO stack at the front
+    times[1] = Bench::run(prefix + "stack", num_ops, 2LL * num_ops, []() {
+        D d{};
+        long long sum{0};
+        for (int i{0}; i < num_ops; ++i)
+            d.addFirst(i);
+        for (int i{0}; i < num_ops; ++i)
+            sum += d.removeFirst();
+        Bench::consume(sum);
+    }, reference[1]);
+
+    // steady state: a small deque through which many objects pass
+    times[2] = Bench::run(prefix + "steady", num_ops, 2LL * num_ops, []() {
+        D d{};
+        long long sum{0};
+        for (int i{0}; i < steady_size; ++i)
+            d.addLast(i);
+        for (int i{0}; i < num_ops; ++i) {
+            d.addLast(i);
+            sum += d.removeFirst();
+        }
+        Bench::consume(sum);
+    }, reference[2]);
+
+    // bursts: the deque repeatedly fills, then drains, releasing its blocks
+    times[3] = Bench::run(prefix + "burst", num_ops, 2LL * num_ops, []() {
+        D d{};
+        long long sum{0};
+        for (int burst{0}; burst < num_ops / burst_size; ++burst) {
+            for (int i{0}; i < burst_size; ++i)
+                d.addLast(i);
+            for (int i{0}; i < burst_size; ++i)
+                sum += d.removeFirst();
+        }
+        Bench::consume(sum);
+    }, reference[3]);
+
+    // forward iteration over a large deque
+    D d{};
+    for (int i{0}; i < num_ops; ++i)
+        d.addLast(i);
+
+    times[4] = Bench::run(prefix + "iterate", num_ops, num_ops, [&d]() {
+        long long sum{0};
+        for (int item : d)
+            sum += item;
+        Bench::consume(sum);
+    }, reference[4]);
+
+    return times;
+}
+
+}
+
+void benchDeque() {
+
+    std::cout << "***** Deque *****" << '\n';
+
+    // speedups are reported relative to the linked list implementation
+    Times reference{benchImplementation<LinkedDeque<int>>("linked", Times{})};
+
+    benchImplementation<Deque<int>>("block", reference);
+    benchImplementation<Deque<int, PoolAllocator<int>>>("pool", reference);
+    benchImplementation<StdDeque<int>>("std", reference);
+
+    // indexed access and binary search, against std::deque; the linked list
+    // implementation has neither
+    std::deque<int> std_deque{};
+    Deque<int> block_deque{};
+    for (int i{0}; i < steady_size * 1'000; ++i) {
+        std_deque.push_back(2 * i);
+        block_deque.addLast(2 * i);
+    }
+
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> pick{0, steady_size * 1'000 - 1};
+    std::vector<int> indices(lookups);
+    for (int& i : indices)
+        i = pick(gen);
+
+    double std_index{Bench::run("deque/index/std", lookups, lookups,
+                                [&std_deque, &indices]() {
+        long long sum{0};
+        for (int i : indices)
+            sum += std_deque[static_cast<std::size_t>(i)];
+        Bench::consume(sum);
+    })};
+
+    Bench::run("deque/index/block", lookups, lookups,
+               [&block_deque, &indices]() {
+        long long sum{0};
+        for (int i : indices)
+            sum += block_deque[i];
+        Bench::consume(sum);
+    }, std_index);
+
+    double std_search{Bench::run("deque/search/std", lookups, lookups,
+                                 [&std_deque, &indices]() {
+        long long sum{0};
+        for (int i : indices)
+            sum += *std::ranges::lower_bound(std_deque, i);
+        Bench::consume(sum);
+    })};
+
+    Bench::run("deque/search/block", lookups, lookups,
+               [&block_deque, &indices]() {
+        long long sum{0};
+        for (int i : indices)
+            sum += *std::ranges::lower_bound(block_deque, i);
+        Bench::consume(sum);
+    }, std_search);
+
+    // draining a deque to a buffer, one object at a time, in bulk, and by
+    // copying its segments; each call first refills the deque
+    const int drain_size{steady_size * 1'000};
+    std::vector<int> buffer(static_cast<std::size_t>(drain_size));
+    Deque<int> drain_deque{};
+
+    auto refill{[&drain_deque, drain_size]() {
+        for (int i{0}; i < drain_size; ++i)
+            drain_deque.addLast(i);
+    }};
+
+    double one_by_one{Bench::run("deque/drain/remove-first", drain_size,
+                                 drain_size,
+                                 [&drain_deque, &buffer, &refill]() {
+        refill();
+        for (int& i : buffer)
+            i = drain_deque.removeFirst();
+        Bench::consume(buffer.back());
+    })};
+
+    Bench::run("deque/drain/drain-to", drain_size, drain_size,
+               [&drain_deque, &buffer, &refill]() {
+        refill();
+        drain_deque.drainTo(buffer.data());
+        Bench::consume(buffer.back());
+    }, one_by_one);
+
+    Bench::run("deque/drain/segments", drain_size, drain_size,
+               [&drain_deque, &buffer, &refill]() {
+        refill();
+        int* out{buffer.data()};
+        for (std::span<const int> segment :
+                 std::as_const(drain_deque).segments()) {
+            std::memcpy(out, segment.data(), segment.size_bytes());
+            out += segment.size();
+        }
+        drain_deque.clear();
+        Bench::consume(buffer.back());
+    }, one_by_one);
+
+    // many short-lived deques of a few objects, as on a per-request path
+    const int requests{10'000};
+    const int per_request{10};
+    const long long request_ops{static_cast<long long>(requests) *
+                                per_request};
+
+    auto request{[](auto& d) {
+        long long sum{0};
+        for (int i{0}; i < per_request; ++i)
+            d.addLast(i);
+        while (!d.isEmpty())
+            sum += d.removeFirst();
+        return sum;
+    }};
+
+    double block_small{Bench::run("deque/small/block", per_request,
+                                  request_ops, [&request]() {
+        long long sum{0};
+        for (int r{0}; r < requests; ++r) {
+            Deque<int> d{};
+            sum += request(d);
+        }
+        Bench::consume(sum);
+    })};
+
+    Bench::run("deque/small/std", per_request, request_ops, [&request]() {
+        long long sum{0};
+        for (int r{0}; r < requests; ++r) {
+            StdDeque<int> d{};
+            sum += request(d);
+        }
+        Bench::consume(sum);
+    }, block_small);
+
+    Bench::run("deque/small/static", per_request, request_ops, [&request]() {
+        long long sum{0};
+        for (int r{0}; r < requests; ++r) {
+            StaticDeque<int, 16> d{};
+            sum += request(d);
+        }
+        Bench::consume(sum);
+    }, block_small);
+
+    // a consumer polls a deque to which an object is added at intervals;
+    // most polls find the deque empty
+    std::stringstream discard{};
+    std::streambuf* cerr_buf{std::cerr.rdbuf(discard.rdbuf())};
+    double caught{Bench::run("deque/poll/catch", poll_interval, polls, []() {
+        Deque<int> d{};
+        long long sum{0};
+        for (int i{0}; i < polls; ++i) {
+            if (i % poll_interval == 0)
+                d.addLast(i);
+            try {
+                sum += d.removeFirst();
+            } catch (const std::out_of_range&) {
+                --sum;
+            }
+        }
+        Bench::consume(sum);
+    })};
+    std::cerr.rdbuf(cerr_buf);
+
+    Bench::run("deque/poll/check", poll_interval, polls, []() {
+        Deque<int> d{};
+        long long sum{0};
+        for (int i{0}; i < polls; ++i) {
+            if (i % poll_interval == 0)
+                d.addLast(i);
+            if (!d.isEmpty())
+                sum += d.removeFirst();
+            else
+                --sum;
+        }
+        Bench::consume(sum);
+    }, caught);
+
+    Bench::run("deque/poll/try", poll_interval, polls, []() {
+        Deque<int> d{};
+        long long sum{0};
+        for (int i{0}; i < polls; ++i) {
+            if (i % poll_interval == 0)
+                d.addLast(i);
+            std::optional<int> item{d.tryRemoveFirst()};
+            sum += item ? *item : -1;
+        }
+        Bench::consume(sum);
+    }, caught);
+
+    std::cout << "*****************" << '\n' << '\n';
+}
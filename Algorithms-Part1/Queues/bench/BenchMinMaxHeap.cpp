@@ -0,0 +1,139 @@
+/**
+ * \file    BenchMinMaxHeap.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of MinMaxHeap, a double-ended priority queue.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "MinMaxHeap.h"
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// number of operations in each mixed run
+constexpr int num_ops{1'000'000};
+
+// number of objects to build a heap from
+constexpr int num_build{1'000'000};
+
+/**
+ * A double-ended priority queue made of two std::priority_queue, one for
+ * each end, the usual alternative to a min-max heap. Each object is held in
+ * both, with an id; an object removed from one end is marked removed, and
+ * is discarded when it reaches the top of the other.
+ */
+class TwoHeaps {
+
+public:
+
+    void add(int value) {
+
+        m_min.emplace(value, m_next);
+        m_max.emplace(value, m_next);
+        m_removed.push_back(false);
+        ++m_next;
+    }
+
+    int removeMin() { return removeTop(m_min); }
+    int removeMax() { return removeTop(m_max); }
+
+private:
+
+    using Entry = std::pair<int, int>;
+
+    template <typename Q>
+    int removeTop(Q& q) {
+
+        while (m_removed[static_cast<std::size_t>(q.top().second)])
+            q.pop();
+
+        Entry top{q.top()};
+        q.pop();
+        m_removed[static_cast<std::size_t>(top.second)] = true;
+        return top.first;
+    }
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>
+        m_min{};
+    std::priority_queue<Entry> m_max{};
+    std::vector<bool> m_removed{};
+    int m_next{0};
+};
+
+}
+
+void benchMinMaxHeap() {
+
+    std::cout << "***** Min-Max Heap *****" << '\n';
+
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> value{0, 1'000'000};
+
+    std::vector<int> values(num_ops);
+    for (int& v : values)
+        v = value(gen);
+    std::vector<unsigned char> ends(num_ops);
+    for (unsigned char& e : ends)
+        e = static_cast<unsigned char>(gen() & 1);
+
+    // a heap of n objects; each operation removes from a random end, then
+    // adds a random object
+    for (int n : {1'000, 100'000}) {
+
+        std::string size{std::to_string(n)};
+
+        double two_pq{Bench::run("heap/mixed/two-pq/" + size, n, num_ops,
+                                 [&values, &ends, n]() {
+            TwoHeaps heaps{};
+            for (int i{0}; i < n; ++i)
+                heaps.add(values[static_cast<std::size_t>(i)]);
+            long long sum{0};
+            for (std::size_t i{0}; i < values.size(); ++i) {
+                sum += ends[i] ? heaps.removeMax() : heaps.removeMin();
+                heaps.add(values[i]);
+            }
+            Bench::consume(sum);
+        })};
+
+        Bench::run("heap/mixed/minmax/" + size, n, num_ops,
+                   [&values, &ends, n]() {
+            MinMaxHeap<int> heap{values.begin(), values.begin() + n};
+            long long sum{0};
+            for (std::size_t i{0}; i < values.size(); ++i) {
+                sum += ends[i] ? heap.removeMax() : heap.removeMin();
+                heap.add(values[i]);
+            }
+            Bench::consume(sum);
+        }, two_pq);
+    }
+
+    std::vector<int> build(num_build);
+    for (int& b : build)
+        b = value(gen);
+
+    // building a heap one object at a time, or all at once
+    double added{Bench::run("heap/build/add", num_build, num_build,
+                            [&build]() {
+        MinMaxHeap<int> heap{};
+        for (int b : build)
+            heap.add(b);
+        Bench::consume(heap.peekMax());
+    })};
+
+    Bench::run("heap/build/heapify", num_build, num_build, [&build]() {
+        MinMaxHeap<int> heap{build.begin(), build.end()};
+        Bench::consume(heap.peekMax());
+    }, added);
+
+    std::cout << "************************" << '\n' << '\n';
+}
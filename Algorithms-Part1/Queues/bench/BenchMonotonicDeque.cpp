@@ -0,0 +1,79 @@
+/**
+ * \file    BenchMonotonicDeque.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of sliding window maxima by MonotonicDeque.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "MonotonicDeque.h"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// number of samples over which each window slides
+constexpr int num_samples{200'000};
+
+}
+
+void benchMonotonicDeque() {
+
+    std::cout << "***** Monotonic Deque *****" << '\n';
+
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> value{0, 1'000'000};
+    std::vector<int> samples(num_samples);
+    for (int& s : samples)
+        s = value(gen);
+
+    std::vector<int> extremes(num_samples);
+
+    for (int width : {16, 256, 4'096}) {
+
+        std::string w{std::to_string(width)};
+
+        // the naive approach: rescan every window for its maximum
+        double rescan{Bench::run("window/rescan/" + w, width, num_samples,
+                                 [&samples, width]() {
+            long long sum{0};
+            for (std::size_t i{static_cast<std::size_t>(width)};
+                 i <= samples.size(); ++i)
+                sum += *std::max_element(
+                    samples.begin() + static_cast<std::ptrdiff_t>(i - width),
+                    samples.begin() + static_cast<std::ptrdiff_t>(i));
+            Bench::consume(sum);
+        })};
+
+        // one push, and one pop once the window is full, per sample
+        Bench::run("window/push-pop/" + w, width, num_samples,
+                   [&samples, width]() {
+            MonotonicDeque<int> window{};
+            long long sum{0};
+            for (int s : samples) {
+                window.push(s);
+                if (window.size() > width)
+                    window.pop();
+                if (window.size() == width)
+                    sum += window.front();
+            }
+            Bench::consume(sum);
+        }, rescan);
+
+        // the whole span of samples at once
+        Bench::run("window/slide/" + w, width, num_samples,
+                   [&samples, &extremes, width]() {
+            MonotonicDeque<int> window{};
+            int written{window.slide(samples, width, extremes)};
+            Bench::consume(extremes[static_cast<std::size_t>(written - 1)]);
+        }, rescan);
+    }
+
+    std::cout << "***************************" << '\n' << '\n';
+}
@@ -0,0 +1,236 @@
+/**
+ * \file    BenchRandomQueue.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of RandomQueue operations.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "Random.h"
+#include "RandomQueue.h"
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * Random order of the indices of a queue of the given size, by a
+ * Fisher-Yates shuffle of an array of indices; the way RandomQueue iterators
+ * previously generated their order.
+ */
+std::vector<int> shuffledIndices(int size) {
+
+    std::vector<int> indices(static_cast<std::size_t>(size));
+    std::iota(indices.begin(), indices.end(), 0);
+
+    for (int i{1}; i < size; ++i) {
+        int r{Random::getRandomNumber(0, i)};
+        std::swap(indices[static_cast<std::size_t>(r)],
+                  indices[static_cast<std::size_t>(i)]);
+    }
+
+    return indices;
+}
+
+}
+
+void benchRandomQueue() {
+
+    std::cout << "***** Random Queue *****" << '\n';
+
+    for (int n : {1'000, 1'000'000}) {
+
+        RandomQueue<int> q{};
+        for (int i{0}; i < n; ++i)
+            q.enqueue(i);
+
+        // the values of the queue, in stored order, for the shuffled indices
+        std::vector<int> stored{};
+        for (RandomQueue<int>::const_iterator it{q.tbegin()}; it != q.tend();
+             ++it)
+            stored.push_back(*it);
+
+        std::string size{std::to_string(n)};
+
+        // time to the first object; speedups are relative to shuffling an
+        // array of indices
+        double shuffled{Bench::run("rq/first/shuffled-" + size, n, 1,
+                                   [&stored, n]() {
+            std::vector<int> order{shuffledIndices(n)};
+            Bench::consume(stored[static_cast<std::size_t>(order.back())]);
+        })};
+
+        Bench::run("rq/first/feistel-" + size, n, 1, [&q]() {
+            Bench::consume(*q.begin());
+        }, shuffled);
+
+        // a full pass over the queue
+        shuffled = Bench::run("rq/iterate/shuffled-" + size, n, n,
+                              [&stored, n]() {
+            std::vector<int> order{shuffledIndices(n)};
+            long long sum{0};
+            for (int i : order)
+                sum += stored[static_cast<std::size_t>(i)];
+            Bench::consume(sum);
+        });
+
+        Bench::run("rq/iterate/feistel-" + size, n, n, [&q]() {
+            long long sum{0};
+            for (int i : q)
+                sum += i;
+            Bench::consume(sum);
+        }, shuffled);
+    }
+
+    // fill and drain a queue in batches, against one object at a time
+    const int n{1'000'000};
+    const int batch{1'000};
+
+    std::vector<int> values(n);
+    std::iota(values.begin(), values.end(), 0);
+
+    double single{Bench::run("rq/drain/single", n, 2 * n, [&values]() {
+        RandomQueue<int> q{};
+        for (int v : values)
+            q.enqueue(v);
+        long long sum{0};
+        while (!q.isEmpty())
+            sum += q.dequeue();
+        Bench::consume(sum);
+    })};
+
+    Bench::run("rq/drain/batch", n, 2 * n, [&values, batch]() {
+        RandomQueue<int> q{};
+        q.enqueueRange(values.begin(), values.end());
+        std::vector<int> out(batch);
+        long long sum{0};
+        while (!q.isEmpty()) {
+            q.dequeueN(batch, out.begin());
+            for (int v : out)
+                sum += v;
+        }
+        Bench::consume(sum);
+    }, single);
+
+    // draw k distinct objects, against sampling until k distinct are found
+    RandomQueue<int> q{};
+    q.enqueueRange(values.begin(), values.begin() + 10 * batch);
+
+    single = Bench::run("rq/sample/rejection", batch, batch, [&q, batch]() {
+        std::vector<bool> seen(10 * batch, false);
+        long long sum{0};
+        for (int found{0}; found < batch; ) {
+            int v{q.sample()};
+            if (seen[static_cast<std::size_t>(v)])
+                continue;
+            seen[static_cast<std::size_t>(v)] = true;
+            sum += v;
+            ++found;
+        }
+        Bench::consume(sum);
+    });
+
+    Bench::run("rq/sample/sampleK", batch, batch, [&q, batch]() {
+        std::vector<int> out(batch);
+        q.sampleK(batch, out.begin());
+        long long sum{0};
+        for (int v : out)
+            sum += v;
+        Bench::consume(sum);
+    }, single);
+
+    // a queue whose size oscillates between 200 and 600 objects, across the
+    // points at which the default policy grows and shrinks its array
+    const int cycles{1'000};
+    const int low{200};
+    const int high{600};
+    const long long oscillate_ops{2LL * cycles * (high - low)};
+
+    auto oscillate{[](RandomQueue<int>& q) {
+        long long sum{0};
+        for (int c{0}; c < cycles; ++c) {
+            while (q.size() < high)
+                q.enqueue(c);
+            while (q.size() > low)
+                sum += q.dequeue();
+        }
+        Bench::consume(sum);
+    }};
+
+    double halve{Bench::run("rq/oscillate/default", high, oscillate_ops,
+                            [&oscillate]() {
+        RandomQueue<int> q{};
+        oscillate(q);
+    })};
+
+    Bench::run("rq/oscillate/shrink-8", high, oscillate_ops, [&oscillate]() {
+        RandomQueue<int> q{GrowthPolicy{2, 8}};
+        oscillate(q);
+    }, halve);
+
+    Bench::run("rq/oscillate/never-shrink", high, oscillate_ops,
+               [&oscillate]() {
+        RandomQueue<int> q{GrowthPolicy::neverShrink()};
+        oscillate(q);
+    }, halve);
+
+    Bench::run("rq/oscillate/reserve", high, oscillate_ops, [&oscillate]() {
+        RandomQueue<int> q{};
+        q.reserve(high);
+        oscillate(q);
+    }, halve);
+
+    // a bulk load, one object at a time, with and without reserving first
+    double grow{Bench::run("rq/load/grow", n, n, []() {
+        RandomQueue<int> q{};
+        for (int i{0}; i < n; ++i)
+            q.enqueue(i);
+        Bench::consume(q.size());
+    })};
+
+    Bench::run("rq/load/reserve", n, n, []() {
+        RandomQueue<int> q{};
+        q.reserve(n);
+        for (int i{0}; i < n; ++i)
+            q.enqueue(i);
+        Bench::consume(q.size());
+    }, grow);
+
+    // many short-lived queues of a few objects, as on a per-request path
+    const int requests{10'000};
+    const int per_request{10};
+    const long long request_ops{static_cast<long long>(requests) *
+                                per_request};
+
+    double heap{Bench::run("rq/small/heap", per_request, request_ops, []() {
+        long long sum{0};
+        for (int r{0}; r < requests; ++r) {
+            RandomQueue<int> q{};
+            for (int i{0}; i < per_request; ++i)
+                q.enqueue(i);
+            while (!q.isEmpty())
+                sum += q.dequeue();
+        }
+        Bench::consume(sum);
+    })};
+
+    Bench::run("rq/small/inline", per_request, request_ops, []() {
+        long long sum{0};
+        for (int r{0}; r < requests; ++r) {
+            SmallRandomQueue<int, 16> q{};
+            for (int i{0}; i < per_request; ++i)
+                q.enqueue(i);
+            while (!q.isEmpty())
+                sum += q.dequeue();
+        }
+        Bench::consume(sum);
+    }, heap);
+
+    std::cout << "************************" << '\n' << '\n';
+}
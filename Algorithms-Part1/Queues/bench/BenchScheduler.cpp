@@ -0,0 +1,120 @@
+/**
+ * \file    BenchScheduler.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of the work-stealing deque against Deque, and of the
+ *          task scheduler against running the same work serially.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "Deque.h"
+#include "TaskScheduler.h"
+#include "WorkStealingDeque.h"
+#include <atomic>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace {
+
+// number of objects pushed and popped by the owner per benchmark
+constexpr int num_items{100'000};
+
+// depth of the binary tree of tasks; one leaf task per unit of work
+constexpr int tree_depth{12};
+constexpr int num_leaves{1 << tree_depth};
+
+// iterations of work done by each leaf task
+constexpr int leaf_work{2'000};
+
+// seed of the work, read at run time so the compiler cannot precompute it
+volatile int seed_base{1};
+
+// a small amount of arithmetic, standing in for the work of a real task
+long long work(int seed) {
+
+    unsigned long long x{static_cast<unsigned long long>(seed + seed_base)};
+    for (int i{0}; i < leaf_work; ++i)
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<long long>(x >> 33);
+}
+
+long long serialTree(int depth, int leaf) {
+
+    if (depth == 0)
+        return work(leaf);
+
+    return serialTree(depth - 1, 2 * leaf) +
+           serialTree(depth - 1, 2 * leaf + 1);
+}
+
+void spawnTree(TaskScheduler& scheduler, int depth, int leaf,
+               std::atomic<long long>& sum) {
+
+    if (depth == 0) {
+        sum.fetch_add(work(leaf), std::memory_order_relaxed);
+        return;
+    }
+
+    scheduler.submit([&scheduler, depth, leaf, &sum]() {
+        spawnTree(scheduler, depth - 1, 2 * leaf, sum);
+    });
+    scheduler.submit([&scheduler, depth, leaf, &sum]() {
+        spawnTree(scheduler, depth - 1, 2 * leaf + 1, sum);
+    });
+}
+
+}
+
+void benchScheduler() {
+
+    std::cout << "***** Work Stealing *****" << '\n';
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+              << '\n';
+
+    // owner operations alone, against the same operations on a Deque
+    double deque{Bench::run("steal/owner/deque", num_items, 2 * num_items,
+                            []() {
+        Deque<int> d{};
+        for (int i{0}; i < num_items; ++i)
+            d.addLast(i);
+        long long sum{0};
+        while (!d.isEmpty())
+            sum += d.removeLast();
+        Bench::consume(sum);
+    })};
+
+    Bench::run("steal/owner/wsdeque", num_items, 2 * num_items, []() {
+        WorkStealingDeque<int> d{};
+        for (int i{0}; i < num_items; ++i)
+            d.push(i);
+        long long sum{0};
+        while (std::optional<int> item{d.pop()})
+            sum += *item;
+        Bench::consume(sum);
+    }, deque);
+
+    // a tree of tasks, against the same recursion run serially
+    double serial{Bench::run("steal/tree/serial", num_leaves, num_leaves,
+                             []() {
+        Bench::consume(serialTree(tree_depth, 0));
+    })};
+
+    TaskScheduler scheduler{};
+    std::string name{"steal/tree/scheduler-" +
+                     std::to_string(scheduler.numWorkers())};
+
+    Bench::run(name, num_leaves, num_leaves, [&scheduler]() {
+        std::atomic<long long> sum{0};
+        scheduler.submit([&scheduler, &sum]() {
+            spawnTree(scheduler, tree_depth, 0, sum);
+        });
+        scheduler.wait();
+        Bench::consume(sum);
+    }, serial);
+
+    std::cout << "*************************" << '\n' << '\n';
+}
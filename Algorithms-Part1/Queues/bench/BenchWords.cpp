@@ -0,0 +1,106 @@
+/**
+ * \file    BenchWords.cpp
+ * \author  Christine Jones
+ * \brief   Benchmarks of splitting input into words: operator>> into a
+ *          std::string against WordReader and WordScanner.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Bench.h"
+#include "Whitespace.h"
+#include "WordReader.h"
+#include "WordScanner.h"
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace {
+
+// bytes of text split per benchmark
+constexpr std::size_t text_bytes{1 << 22};
+
+// lines of short words of random lengths, as in the permutation client's
+// typical input; the lengths vary so that branches on them are not
+// predictable
+std::string makeText() {
+
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> length{1, 12};
+    std::uniform_int_distribution<int> words_per_line{1, 16};
+
+    std::string text{};
+    text.reserve(text_bytes + 256);
+    while (text.size() < text_bytes) {
+        int words{words_per_line(gen)};
+        for (int i{0}; i < words; ++i) {
+            text.append(static_cast<std::size_t>(length(gen)), 'w');
+            text += (i + 1 < words) ? ' ' : '\n';
+        }
+    }
+
+    return text;
+}
+
+}
+
+void benchWords() {
+
+    std::cout << "***** Words *****" << '\n';
+
+    const std::string text{makeText()};
+    const long long   n{static_cast<long long>(text.size())};
+
+    // each operation is one byte of input; speedups are relative to
+    // operator>>, which copies every word into a string
+    double extract{Bench::run("words/extract", n, n, [&text]() {
+        std::istringstream input{text};
+        std::string word{};
+        long long total{0};
+        while (input >> word)
+            total += static_cast<long long>(word.size());
+        Bench::consume(total);
+    })};
+
+    Bench::run("words/reader", n, n, [&text]() {
+        std::istringstream input{text};
+        WordReader reader{input};
+        std::string_view word{};
+        long long total{0};
+        while (reader.next(word))
+            total += static_cast<long long>(word.size());
+        Bench::consume(total);
+    }, extract);
+
+    // the scanner, with and without classifying sixteen characters at a time
+    Bench::run("words/scanner/scalar", n, n, [&text]() {
+        std::size_t i{0};
+        std::size_t end{text.size()};
+        long long total{0};
+        while (true) {
+            while (i < end && Whitespace::isSpace(text[i]))
+                ++i;
+            if (i == end)
+                break;
+            std::size_t begin{i};
+            while (i < end && !Whitespace::isSpace(text[i]))
+                ++i;
+            total += static_cast<long long>(i - begin);
+        }
+        Bench::consume(total);
+    }, extract);
+
+    Bench::run("words/scanner", n, n, [&text]() {
+        WordScanner scanner{text};
+        std::string_view word{};
+        long long total{0};
+        while (scanner.next(word))
+            total += static_cast<long long>(word.size());
+        Bench::consume(total);
+    }, extract);
+
+    std::cout << "*****************" << '\n' << '\n';
+}
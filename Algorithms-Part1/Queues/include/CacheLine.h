@@ -0,0 +1,24 @@
+/**
+ * \file    CacheLine.h
+ * \author  Christine Jones
+ * \brief   Size of a cache line, for the layout of the concurrent queues.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef CACHE_LINE_H
+#define CACHE_LINE_H
+
+#include <cstddef>
+
+/**
+ * Size of a cache line on the target processors. Data written by different
+ * threads is aligned to it, so that the threads do not invalidate each
+ * other's cache lines. Fixed, rather than
+ * std::hardware_destructive_interference_size, so that the layout does not
+ * vary with compiler flags.
+ */
+inline constexpr std::size_t cache_line_size{64};
+
+#endif // CACHE_LINE_H
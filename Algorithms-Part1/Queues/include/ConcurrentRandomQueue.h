@@ -0,0 +1,337 @@
+/**
+ * \file    ConcurrentRandomQueue.h
+ * \author  Christine Jones
+ * \brief   Definition of class that implements a thread-safe randomized
+ *          queue.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef CONCURRENT_RANDOM_QUEUE_H
+#define CONCURRENT_RANDOM_QUEUE_H
+
+#include "CacheLine.h"
+#include "ContainerError.h"
+#include "Random.h"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>      // for std::move, std::swap
+#include <vector>
+
+/**
+ * Class that implements a randomized queue that may be used by any number of
+ * threads at once. As with RandomQueue, objects removed are chosen uniformly
+ * at random among all the objects in the queue.
+ *
+ * Objects are stored in a fixed number of shards, each an array guarded by
+ * its own mutex and with its own random number generator, so that threads
+ * using different shards do not contend. Each thread is assigned a local
+ * shard, round robin, the first time it uses any queue. An object added is
+ * stored in a shard chosen uniformly at random; an object is removed, or
+ * sampled, uniformly at random from the local shard, or, if the local shard
+ * is empty, from the next non-empty shard, i.e., it is stolen from another
+ * thread's shard.
+ *
+ * Uniformity: since every object is stored in a uniformly random shard,
+ * independently of every other object, and objects are chosen without
+ * regard to their values, the contents of the queue are exchangeable: no
+ * object is more likely than another to be in any given position of any
+ * shard. Hence, when the queue is not being modified by another thread, each
+ * object in the queue is equally likely to be removed, or sampled, no matter
+ * which shard it is taken from. This holds across any sequence of
+ * operations, as long as the sequence does not depend on the values of the
+ * objects removed. While other threads modify the queue, the object is
+ * chosen uniformly among the objects present at the moment its shard is
+ * locked.
+ *
+ * This randomized queue holds objects of a templated type. The templated type
+ * must be MoveConstructible and MoveAssignable; it must also be
+ * CopyConstructible to sample objects or to add objects by const reference.
+ * Objects are sampled by copy, as another thread may remove the object
+ * while the copy is in use.
+ */
+template <typename T>
+class ConcurrentRandomQueue {
+
+public:
+
+    /**
+     * Constructor. Initializes an empty queue with the given number of
+     * shards; defaults to one per hardware thread. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     *
+     * \param int Number of shards.
+     */
+    explicit ConcurrentRandomQueue(int num_shards = defaultShards());
+
+    /**
+     * Destructor. Releases all memory allocated to the queue. No thread may
+     * be using the queue.
+     */
+    ~ConcurrentRandomQueue() = default;
+
+    /**
+     * Number of objects in the queue. Exact only if no thread is modifying
+     * the queue; otherwise a snapshot that may already be out of date.
+     */
+    int size() const { return m_size.load(std::memory_order_relaxed); }
+
+    /**
+     * Determines if the queue is empty; subject to the same caveat as size().
+     */
+    bool isEmpty() const { return size() == 0; }
+
+    /**
+     * Number of shards in which objects are stored.
+     */
+    int numShards() const { return m_num_shards; }
+
+    /**
+     * Adds an object to the queue. An exception of type std::bad_alloc is
+     * thrown in the case that memory fails to be allocated.
+     *
+     * \param T Object to be added to the queue; copied or moved.
+     */
+    void enqueue(const T& item) { emplace(item); }
+    void enqueue(T&& item) { emplace(std::move(item)); }
+
+    /**
+     * Constructs an object in the queue from the given arguments. An
+     * exception of type std::bad_alloc is thrown in the case that memory
+     * fails to be allocated.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * Removes a random object from the queue. An exception of type
+     * std::out_of_range is thrown in the case that the queue is empty.
+     *
+     * \return T Object removed from queue.
+     */
+    T dequeue();
+
+    /**
+     * Removes a random object from the queue, if any. Unlike checking
+     * isEmpty() before calling dequeue(), this cannot fail because another
+     * thread emptied the queue in between.
+     *
+     * \return Object removed from queue; empty if the queue is empty.
+     */
+    std::optional<T> tryDequeue();
+
+    /**
+     * Returns a copy of a random object in the queue, without removing it.
+     * An exception of type std::out_of_range is thrown in the case that the
+     * queue is empty.
+     *
+     * \return T Copy of an object in the queue.
+     */
+    T sample();
+
+    /**
+     * Returns a copy of a random object in the queue, if any, without
+     * removing it.
+     *
+     * \return Copy of an object in queue; empty if the queue is empty.
+     */
+    std::optional<T> trySample();
+
+    /**
+     * Default number of shards; one per hardware thread.
+     */
+    static int defaultShards() {
+        unsigned threads{std::thread::hardware_concurrency()};
+        return threads > 0 ? static_cast<int>(threads) : 1;
+    }
+
+    // copying, assigning, moving a queue is not supported
+    ConcurrentRandomQueue(const ConcurrentRandomQueue& queue) = delete;
+    ConcurrentRandomQueue& operator= (const ConcurrentRandomQueue& queue)
+        = delete;
+
+private:
+
+    // each shard on its own cache lines, so that threads locking different
+    // shards do not contend for the same line
+    struct alignas(cache_line_size) Shard {
+        std::mutex         mutex{};
+        std::vector<T>     items{};
+        Random::Xoshiro256 gen{};
+    };
+
+    // shard assigned to the current thread
+    int localShard() const;
+
+    // random number generator used by the current thread to choose the
+    // shard to which objects are added
+    static Random::Xoshiro256& threadGenerator();
+
+    // find a non-empty shard, starting with the local shard, and apply the
+    // given function to a uniformly random index of that shard, holding its
+    // lock
+    template <typename F>
+    auto withRandomItem(F&& func) -> std::optional<decltype(
+        func(std::declval<Shard&>(), std::size_t{}))>;
+
+    int                      m_num_shards{0};
+    std::unique_ptr<Shard[]> m_shards{};
+    std::atomic<int>         m_size{0};
+
+};
+
+template <typename T>
+ConcurrentRandomQueue<T>::ConcurrentRandomQueue(int num_shards):
+    m_num_shards{num_shards}
+{
+    assert(num_shards > 0);
+
+    try {
+
+        m_shards = std::make_unique<Shard[]>(
+                       static_cast<std::size_t>(num_shards));
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "ConcurrentRandomQueue::ConcurrentRandomQueue: "
+                  << e.what() << '\n';
+        throw;
+    }
+
+    // seed each shard's engine from the global engine, so that the shards
+    // produce distinct sequences
+    for (int i{0}; i < num_shards; ++i)
+        m_shards[static_cast<std::size_t>(i)].gen.seed(Random::genXoshiro());
+}
+
+template <typename T>
+template <typename... Args>
+void ConcurrentRandomQueue<T>::emplace(Args&&... args) {
+
+    int index{0};
+    if (m_num_shards > 1)
+        index = static_cast<int>(Random::boundedNumber(
+                    threadGenerator(),
+                    static_cast<std::uint32_t>(m_num_shards)));
+
+    Shard& shard{m_shards[static_cast<std::size_t>(index)]};
+
+    {
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        try {
+
+            shard.items.emplace_back(std::forward<Args>(args)...);
+
+        } catch (const std::bad_alloc& e) {
+
+            std::cerr << "ConcurrentRandomQueue::emplace: " << e.what()
+                      << '\n';
+            throw;
+        }
+    }
+
+    m_size.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+T ConcurrentRandomQueue<T>::dequeue() {
+
+    std::optional<T> item{tryDequeue()};
+    if (!item)
+        ContainerError::throwEmpty("ConcurrentRandomQueue::dequeue", "queue");
+
+    return std::move(*item);
+}
+
+template <typename T>
+std::optional<T> ConcurrentRandomQueue<T>::tryDequeue() {
+
+    std::optional<T> item{withRandomItem([](Shard& shard, std::size_t i) {
+        std::vector<T>& items{shard.items};
+        if (i != items.size() - 1)
+            std::swap(items[i], items.back());
+        T removed{std::move(items.back())};
+        items.pop_back();
+        return removed;
+    })};
+
+    if (item)
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+
+    return item;
+}
+
+template <typename T>
+T ConcurrentRandomQueue<T>::sample() {
+
+    std::optional<T> item{trySample()};
+    if (!item)
+        ContainerError::throwEmpty("ConcurrentRandomQueue::sample", "queue");
+
+    return std::move(*item);
+}
+
+template <typename T>
+std::optional<T> ConcurrentRandomQueue<T>::trySample() {
+
+    return withRandomItem([](Shard& shard, std::size_t i) {
+        return T{shard.items[i]};
+    });
+}
+
+template <typename T>
+int ConcurrentRandomQueue<T>::localShard() const {
+
+    // threads are numbered once, in the order they first use any queue of
+    // this type
+    static std::atomic<int> next_thread{0};
+    thread_local int thread_number{next_thread.fetch_add(1)};
+
+    return thread_number % m_num_shards;
+}
+
+template <typename T>
+Random::Xoshiro256& ConcurrentRandomQueue<T>::threadGenerator() {
+
+    thread_local Random::Xoshiro256 gen{std::random_device{}()};
+    return gen;
+}
+
+template <typename T>
+template <typename F>
+auto ConcurrentRandomQueue<T>::withRandomItem(F&& func) -> std::optional<
+    decltype(func(std::declval<Shard&>(), std::size_t{}))> {
+
+    int local{localShard()};
+
+    // the local shard first, then steal from the others in turn
+    for (int i{0}; i < m_num_shards; ++i) {
+
+        Shard& shard{m_shards[static_cast<std::size_t>(
+                         (local + i) % m_num_shards)]};
+
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        if (shard.items.empty())
+            continue;
+
+        std::uint32_t index{Random::boundedNumber(
+            shard.gen, static_cast<std::uint32_t>(shard.items.size()))};
+        return func(shard, index);
+    }
+
+    return std::nullopt;
+}
+
+#endif // CONCURRENT_RANDOM_QUEUE_H
@@ -0,0 +1,52 @@
+/**
+ * \file    ContainerError.h
+ * \author  Christine Jones
+ * \brief   ContainerError namespace; reporting of errors by the containers.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef CONTAINER_ERROR_H
+#define CONTAINER_ERROR_H
+
+namespace ContainerError {
+
+/**
+ * Reports an attempt to access an object of an empty container: logs the
+ * error to std::cerr and throws an exception of type std::out_of_range.
+ * Defined out of line, and never returns, so that the logging and the throw
+ * are not inlined into the containers' methods; the caller keeps only a
+ * test and a call on its cold path.
+ *
+ * \param char* Name of the method, e.g., "Deque::removeFirst".
+ * \param char* Name of the container, e.g., "deque".
+ */
+[[noreturn]] void throwEmpty(const char* method, const char* container);
+
+/**
+ * Reports an index outside the range of a container: logs the error to
+ * std::cerr and throws an exception of type std::out_of_range.
+ *
+ * \param char* Name of the method, e.g., "Deque::at".
+ * \param char* Name of the container, e.g., "deque".
+ * \param long  Index given to the method.
+ */
+[[noreturn]] void throwOutOfRange(const char* method, const char* container,
+                                  long long index);
+
+/**
+ * Reports a request for more objects than a container holds: logs the error
+ * to std::cerr and throws an exception of type std::out_of_range.
+ *
+ * \param char* Name of the method, e.g., "Deque::removeFirstN".
+ * \param char* Name of the container, e.g., "deque".
+ * \param long  Number of objects requested.
+ * \param long  Number of objects the container holds.
+ */
+[[noreturn]] void throwTooFew(const char* method, const char* container,
+                              long long requested, long long size);
+
+}
+
+#endif // CONTAINER_ERROR_H
@@ -1,76 +1,274 @@
 /**
  * \file    Deque.h
- * \author  Christine Jones 
+ * \author  Christine Jones
  * \brief   Definition of class that implements a deque data structure.
  *
  * \copyright 2024
- * \license   GNU GENERAL PUBLIC LICENSE version 3 
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
  */
 
 #ifndef DEQUE_H
 #define DEQUE_H
 
-#include "Node.h"
+#include "ContainerError.h"
+#include <algorithm>    // for std::min, std::move
 #include <cassert>
+#include <compare>
 #include <cstddef>      // for std::ptrdiff_t
 #include <exception>
 #include <iostream>
 #include <iterator>
+#include <memory>       // for std::allocator, std::allocator_traits
+#include <optional>
+#include <ranges>       // for std::ranges::subrange
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>      // for std::forward, std::move
 
 /**
  * Class that implementa a deque data structure. A deque is a double-ended
  * queue that supports the addition and removal of objects from either the
  * front or back of the queue.
- * 
- * This deque is implemented using a linked list and supports each deque
- * operation (including construction) in constant worst-case time.
- * 
+ *
+ * This deque is implemented as a sequence of fixed-size blocks of objects.
+ * The blocks are referenced, in order, by a circular array of block pointers
+ * (the map). Objects are stored contiguously within each block, so that
+ * adding or removing an object only allocates or releases memory when a block
+ * boundary is crossed. A single released block is kept as a spare for reuse,
+ * so that a deque oscillating across a block boundary does not repeatedly
+ * allocate and release memory.
+ *
+ * Each deque operation is performed in constant worst-case time, except when
+ * the map fills and doubles in capacity. Growing the map copies one pointer
+ * per block, so is performed in constant amortized time.
+ *
+ * Since every block but the first and last is full, the object at any index
+ * is found in constant time from the offset of the first object within its
+ * block: the quotient by the block size selects the block, and the remainder
+ * the object within it. Hence the deque supports indexed access, and its
+ * iterators are random access, e.g., for binary search with std::ranges.
+ * Adding an object invalidates all iterators, as the map may be replaced.
+ * Removing an object invalidates iterators to that object and the
+ * past-the-end iterator, which is recomputed from the last object and may
+ * point into a block that has been released; iterators to the other objects
+ * remain valid. References to objects are never invalidated, except by
+ * removing the object.
+ *
+ * Objects may be removed from the beginning of the deque in bulk, a block at
+ * a time, and the objects of the deque may be viewed as the sequence of
+ * contiguous spans that make up the blocks, e.g., to hand a batch of objects
+ * to writev(2) without copying them.
+ *
+ * Blocks, and the map, are obtained from the given allocator, which defaults
+ * to std::allocator. A PoolAllocator (see PoolAllocator.h), sized to
+ * Deque::block_bytes, recycles released blocks without returning them to the
+ * global heap.
+ *
  * This deque holds objects of a templated type. The templated type must be
- * CopyAssignable and CopyConstructible.
+ * MoveConstructible; it must also be CopyConstructible to add objects by
+ * const reference. Objects are moved, rather than copied, out of the deque
+ * when removed, unless the move constructor may throw and a copy constructor
+ * is available.
  */
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class Deque {
 
+    // number of objects per block; roughly 1 KiB per block, at least 16
+    static constexpr int s_block_bytes{1024};
+    static constexpr int s_block_size{
+        sizeof(T) * 16 < s_block_bytes ?
+            static_cast<int>(s_block_bytes / sizeof(T)) : 16};
+
 public:
 
+    using allocator_type = Alloc;
+
+    // size, in bytes, of each block allocated by the deque
+    static constexpr std::size_t block_bytes{s_block_size * sizeof(T)};
+
     /**
-     * Custom iterator that allows for forward passes over the deque.
-     */ 
+     * Custom random access iterator over the deque. An iterator refers to
+     * its deque, so that the distance between any two iterators is measured
+     * from the deque's current first block.
+     */
     template <typename U>
     class iter {
     public:
 
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using difference_type   = std::ptrdiff_t;
-        using value_type        = U;
+        using value_type        = std::remove_cv_t<U>;
         using pointer           = U*;
         using reference         = U&;
 
-        iter(): m_ptr(nullptr) {}
-        iter(Node<T>* ptr): m_ptr(ptr) {}
+        iter() {}
+        iter(const Deque* deque, int node, T* cur):
+            m_deque{deque},
+            m_node{node},
+            m_block{deque->m_map[node]},
+            m_cur{cur}
+        {}
+
+        // an iterator converts to a const_iterator
+        template <typename V,
+                  typename = std::enable_if_t<std::is_same_v<const V, U> &&
+                                              !std::is_same_v<V, U>>>
+        iter(const iter<V>& other):
+            m_deque{other.m_deque},
+            m_node{other.m_node},
+            m_block{other.m_block},
+            m_cur{other.m_cur}
+        {}
+
+        reference operator*() const { return *m_cur; }
+        pointer operator->() const  { return m_cur; }
+        reference operator[](difference_type n) const
+            { return *(*this + n); }
+
+        iter& operator++() {
+
+            // continue at the beginning of the next block
+            if (++m_cur == m_block + s_block_size)
+                setNode(m_node + 1, 0);
+            return *this;
+        }
+        iter operator++(int) { iter tmp = *this; ++(*this); return tmp;}
 
-        reference operator*() const { return m_ptr->item(); }
-        pointer operator->() const  { return m_ptr->itemPtr(); }
+        iter& operator--() {
 
-        iter& operator++() { m_ptr = m_ptr->next(); return *this; }
-        iter operator++(int) { iter tmp = *this; ++(*this); return tmp;}
+            // continue at the end of the previous block
+            if (m_cur == m_block)
+                setNode(m_node - 1, s_block_size);
+            --m_cur;
+            return *this;
+        }
+        iter operator--(int) { iter tmp = *this; --(*this); return tmp;}
+
+        iter& operator+=(difference_type n) {
+
+            difference_type offset{(m_cur - m_block) + n};
+
+            // within the current block
+            if (offset >= 0 && offset < s_block_size) {
+
+                m_cur += n;
+                return *this;
+            }
+
+            // otherwise, the number of blocks to move, rounded down
+            difference_type blocks{offset >= 0 ?
+                                   offset / s_block_size :
+                                   -((-offset - 1) / s_block_size) - 1};
+            setNode(m_node + static_cast<int>(blocks),
+                    offset - blocks * s_block_size);
+            return *this;
+        }
+        iter& operator-=(difference_type n) { return *this += -n; }
+
+        friend iter operator+(iter it, difference_type n) { return it += n; }
+        friend iter operator+(difference_type n, iter it) { return it += n; }
+        friend iter operator-(iter it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const iter& a, const iter& b)
+            { return a.position() - b.position(); }
 
         friend bool operator==(const iter& a, const iter& b)
-            { return a.m_ptr == b.m_ptr; }
-        friend bool operator!=(const iter& a, const iter& b)
-            { return a.m_ptr != b.m_ptr; }
+            { return a.m_cur == b.m_cur; }
+        friend std::strong_ordering operator<=>(const iter& a, const iter& b)
+            { return a.position() <=> b.position(); }
 
     private:
 
-        Node<T>* m_ptr{nullptr};
+        template <typename> friend class iter;
+
+        // move to the given offset within the block at the given map index,
+        // which wraps around the end of the map
+        void setNode(int node, difference_type offset) {
+
+            m_node = node & (m_deque->m_map_capacity - 1);
+            m_block = m_deque->m_map[m_node];
+            m_cur = m_block + offset;
+        }
+
+        // offset of the current object from the beginning of the deque's
+        // first block
+        difference_type position() const {
+
+            if (m_deque == nullptr)
+                return 0;
+
+            int block{(m_node - m_deque->m_first_node) &
+                      (m_deque->m_map_capacity - 1)};
+            return static_cast<difference_type>(block) * s_block_size +
+                   (m_cur - m_block);
+        }
+
+        const Deque* m_deque{nullptr};  // deque iterated over
+        int          m_node{0};         // map index of current block
+        T*           m_block{nullptr};  // current block
+        T*           m_cur{nullptr};    // current object within block
     };
     typedef iter<T>       iterator;
     typedef iter<const T> const_iterator;
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
     /**
-     * Constructor. Initializes an empty deque.
+     * Custom forward iterator over the contiguous segments of the deque, one
+     * span of objects per block in use, in order.
      */
-    Deque();
+    template <typename U>
+    class segment_iter {
+    public:
+
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = std::span<U>;
+
+        segment_iter() {}
+        segment_iter(const Deque* deque, int block):
+            m_deque{deque},
+            m_block{block}
+        {}
+
+        std::span<U> operator*() const {
+
+            const Deque& d{*m_deque};
+            T* block{d.m_map[(d.m_first_node + m_block) &
+                             (d.m_map_capacity - 1)]};
+
+            // the first and last segments are partial blocks
+            T* begin{m_block == 0 ? d.m_first : block};
+            T* end{m_block == d.m_num_blocks - 1 ? d.m_last
+                                                 : block + s_block_size};
+            return std::span<U>{begin, end};
+        }
+
+        segment_iter& operator++() { ++m_block; return *this; }
+        segment_iter operator++(int)
+            { segment_iter tmp = *this; ++(*this); return tmp; }
+
+        friend bool operator==(const segment_iter& a, const segment_iter& b)
+            { return a.m_block == b.m_block; }
+
+    private:
+
+        const Deque* m_deque{nullptr};  // deque iterated over
+        int          m_block{0};        // index of block from the first
+    };
+    typedef std::ranges::subrange<segment_iter<T>>       segment_range;
+    typedef std::ranges::subrange<segment_iter<const T>> const_segment_range;
+
+    /**
+     * Constructor. Initializes an empty deque. No memory is allocated until
+     * the first object is added.
+     *
+     * \param Alloc Allocator from which blocks, and the map, are obtained.
+     */
+    Deque(): Deque(Alloc{}) {}
+    explicit Deque(const Alloc& alloc);
 
     /**
      * Destructor. Releases all memory allocted to the deque.
@@ -79,14 +277,14 @@ public:
 
     /**
      * Determine if the deque is empty.
-     * 
+     *
      * \return True if no objects in deque; False otherwise.
      */
     bool isEmpty() const { return m_size == 0; }
 
     /**
      * Returns the number of objects contained in the deque.
-     * 
+     *
      * \return Number of objects in deque.
      */
     int size() const { return m_size; }
@@ -95,34 +293,140 @@ public:
      * Methods to add object to beginning/end of deque. An exception of type
      * std::bad_alloc is thrown in the case that memory fails to be allocated.
      *
-     * \param T Object to be added to the deque.
+     * \param T Object to be copied, or moved, into the deque.
+     */
+    void addFirst(const T& item) { emplaceFirst(item); }
+    void addFirst(T&& item)      { emplaceFirst(std::move(item)); }
+    void addLast(const T& item)  { emplaceLast(item); }
+    void addLast(T&& item)       { emplaceLast(std::move(item)); }
+
+    /**
+     * Methods to construct object in place at beginning/end of deque. An
+     * exception of type std::bad_alloc is thrown in the case that memory fails
+     * to be allocated.
+     *
+     * \param Args Arguments forwarded to the constructor of the object.
+     * \return Reference to the newly constructed object.
      */
-    void addFirst(const T& item);
-    void addLast(const T& item);
+    template <typename... Args>
+    T& emplaceFirst(Args&&... args);
+    template <typename... Args>
+    T& emplaceLast(Args&&... args);
 
     /**
      * Methods to remove object from beginning/end of deque. An exception of
      * type std::out_of_range is thrown in the case that the deque is empty.
-     * 
+     *
      * \return Object removed from deque.
      */
     T removeFirst();
     T removeLast();
 
+    /**
+     * Methods to remove object from beginning/end of deque, if any. Nothing
+     * is logged or thrown in the case that the deque is empty, so a caller
+     * that polls the deque pays only for the test; unless the object's move
+     * constructor may throw, nothing is thrown at all.
+     *
+     * \return Object removed from deque; empty if the deque is empty.
+     */
+    std::optional<T> tryRemoveFirst()
+        noexcept(std::is_nothrow_move_constructible_v<T>);
+    std::optional<T> tryRemoveLast()
+        noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * Methods that return the object at the beginning/end of deque, without
+     * removing it. An exception of type std::out_of_range is thrown in the
+     * case that the deque is empty.
+     *
+     * \return Reference to the object.
+     */
+    T& peekFirst();
+    const T& peekFirst() const;
+    T& peekLast();
+    const T& peekLast() const;
+
+    /**
+     * Removes the given number of objects from the beginning of the deque,
+     * in order, moving them to the given output iterator a block at a time;
+     * drainTo() removes every object. Each block is released once emptied.
+     * An exception of type std::out_of_range is thrown, and no object
+     * removed, in the case that the given number is negative or the deque
+     * holds fewer objects than it.
+     *
+     * \param int      Number of objects to be removed.
+     * \param OutputIt Iterator to which the objects are moved.
+     *
+     * \return OutputIt Iterator past the last object moved.
+     */
+    template <typename OutputIt>
+    OutputIt removeFirstN(int n, OutputIt out);
+    template <typename OutputIt>
+    OutputIt drainTo(OutputIt out) { return removeFirstN(m_size, out); }
+
+    /**
+     * Methods that return the objects of the deque as a range of contiguous
+     * spans, one per block, in order; no span is empty. The spans are
+     * invalidated as iterators are, by adding or removing objects.
+     *
+     * \return Range of spans of objects.
+     */
+    segment_range segments()
+        { return segment_range{segment_iter<T>{this, 0},
+                               segment_iter<T>{this, numSegments()}}; }
+    const_segment_range segments() const
+        { return const_segment_range{
+              segment_iter<const T>{this, 0},
+              segment_iter<const T>{this, numSegments()}}; }
+
+    /**
+     * Methods that return the object at the given index, counted from the
+     * beginning of the deque, in constant time. The index must be in
+     * [0, size) for operator[]; at() throws an exception of type
+     * std::out_of_range in the case that it is not.
+     *
+     * \param int Index of the object.
+     *
+     * \return Reference to the object.
+     */
+    T& operator[](int index)
+        { assert(index >= 0 && index < m_size); return *pointerTo(index); }
+    const T& operator[](int index) const
+        { assert(index >= 0 && index < m_size); return *pointerTo(index); }
+    T& at(int index);
+    const T& at(int index) const;
+
     /**
      * Clears all objects from the deque, releasing allocated memory.
      * Reinitializes to an empty deque.
      */
     void clear();
 
-    // iterators that allow forward passes over the deque
-    iterator begin() { return iterator(m_first); }
-    iterator end()   { return iterator(nullptr); }
-
-    const_iterator begin() const  { return const_iterator{m_first}; }
-    const_iterator cbegin() const { return const_iterator{m_first}; }
-    const_iterator end() const    { return const_iterator{nullptr}; }
-    const_iterator cend() const   { return const_iterator{nullptr}; }
+    // random access iterators over the deque, forward and reverse
+    iterator begin() { return makeIterator<iterator>(m_first_node, m_first); }
+    iterator end()   { return makeIterator<iterator>(lastNode(), m_last); }
+
+    const_iterator begin() const
+        { return makeIterator<const_iterator>(m_first_node, m_first); }
+    const_iterator cbegin() const
+        { return makeIterator<const_iterator>(m_first_node, m_first); }
+    const_iterator end() const
+        { return makeIterator<const_iterator>(lastNode(), m_last); }
+    const_iterator cend() const
+        { return makeIterator<const_iterator>(lastNode(), m_last); }
+
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend()   { return reverse_iterator{begin()}; }
+
+    const_reverse_iterator rbegin() const
+        { return const_reverse_iterator{end()}; }
+    const_reverse_iterator crbegin() const
+        { return const_reverse_iterator{cend()}; }
+    const_reverse_iterator rend() const
+        { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crend() const
+        { return const_reverse_iterator{cbegin()}; }
 
     // copying, assigning, moving a deque is not currently supported
     Deque(const Deque& deque) = delete;
@@ -132,163 +436,524 @@ public:
 
 private:
 
-    Node<T>* m_first{nullptr};  // beginning of linked list
-    Node<T>* m_last{nullptr};   // end of linked list
-    int      m_size{0};         // size of linked list, i.e., deque
+    static constexpr int s_initial_map_capacity{8}; // must be a power of two
+
+    // map index of the last block in use
+    int lastNode() const
+        { return (m_first_node + m_num_blocks - 1) & (m_map_capacity - 1); }
+
+    // iterator to the given object within the given block
+    template <typename I>
+    I makeIterator(int node, T* cur) const
+        { return m_map == nullptr ? I{} : I{this, node, cur}; }
+
+    // number of blocks that hold objects; the last block in use is empty
+    // when the last object fills the end of the previous block
+    int numSegments() const
+        { return m_size == 0 ? 0 : m_num_blocks - (m_last == m_last_block); }
+
+    // the object at the given index; the offset of the first object within
+    // the first block, plus the index, selects the block and the object
+    T* pointerTo(int index) const {
+        int offset{static_cast<int>(m_first - m_first_block) + index};
+        return m_map[(m_first_node + offset / s_block_size) &
+                     (m_map_capacity - 1)] + offset % s_block_size;
+    }
+
+    // remove the first/last object; the deque must not be empty
+    T takeFirst();
+    T takeLast();
+
+    // add/remove objects across a block boundary; kept out of line so that
+    // the common case, within a block, is small enough to inline
+    template <typename... Args>
+    T&   emplaceFirstBlock(Args&&... args);
+    void addLastBlock();
+    void removeFirstBlock();
+    T    removeLastBlock();
+
+    // manage blocks of objects; a single released block is kept as spare
+    T*   acquireBlock();
+    void releaseBlock(T* block);
+
+    // manage the map of blocks
+    void initMap();
+    void growMap();
+
+    // Blocks in use are referenced by m_map, in order, starting at index
+    // m_first_node and wrapping around the end of the map. Objects run from
+    // m_first, within the first block, up to but not including m_last, within
+    // the last block. There is always a block allocated for the position
+    // m_last, i.e., m_last never points to the end of its block.
+    T**  m_map{nullptr};         // circular array of block pointers
+    int  m_map_capacity{0};      // number of block pointers in map
+    int  m_first_node{0};        // map index of first block in use
+    int  m_num_blocks{0};        // number of blocks in use
+    T*   m_first_block{nullptr}; // first block in use
+    T*   m_first{nullptr};       // first object in deque
+    T*   m_last_block{nullptr};  // last block in use
+    T*   m_last{nullptr};        // position following last object in deque
+    int  m_size{0};              // number of objects in deque
+    T*   m_spare{nullptr};       // released block kept for reuse
+
+    using BlockTraits = std::allocator_traits<Alloc>;
+    using MapAlloc    = typename BlockTraits::template rebind_alloc<T*>;
+    using MapTraits   = std::allocator_traits<MapAlloc>;
+
+    Alloc    m_block_alloc{};       // allocator of blocks
+    MapAlloc m_map_alloc{};         // allocator of the map
 
 };
 
-template <typename T>
-Deque<T>::Deque():
+template <typename T, typename Alloc>
+Deque<T, Alloc>::Deque(const Alloc& alloc):
+    m_map{nullptr},
+    m_map_capacity{0},
+    m_first_node{0},
+    m_num_blocks{0},
+    m_first_block{nullptr},
     m_first{nullptr},
+    m_last_block{nullptr},
     m_last{nullptr},
-    m_size{0}
+    m_size{0},
+    m_spare{nullptr},
+    m_block_alloc{alloc},
+    m_map_alloc{alloc}
 {}
 
-template <typename T>
-Deque<T>::~Deque() {
+template <typename T, typename Alloc>
+Deque<T, Alloc>::~Deque() {
 
     clear();
 }
 
-template <typename T>
-void Deque<T>::addFirst(const T& item) {
+template <typename T, typename Alloc>
+template <typename... Args>
+T& Deque<T, Alloc>::emplaceFirst(Args&&... args) {
+
+    if (m_map == nullptr)
+        initMap();
+
+    // room remains at the beginning of the first block
+    if (m_first != m_first_block) {
+
+        BlockTraits::construct(m_block_alloc, m_first - 1,
+                               std::forward<Args>(args)...);
+        --m_first;
+        ++m_size;
+        return *m_first;
+    }
+
+    // otherwise, a new first block is required
+    return emplaceFirstBlock(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+T& Deque<T, Alloc>::emplaceFirstBlock(Args&&... args) {
 
-    Node<T>* new_node{nullptr};
+    T* block{nullptr};
 
     try {
 
-        new_node = new Node<T>(item, m_first, nullptr);
+        if (m_num_blocks == m_map_capacity)
+            growMap();
+
+        block = acquireBlock();
 
     } catch (const std::bad_alloc& e) {
 
-        std::cerr << "Deque::addFirst: " << e.what() << '\n';
+        std::cerr << "Deque::emplaceFirst: " << e.what() << '\n';
         throw;
     }
 
-    if (m_size > 0) {
+    try {
 
-        assert(m_first != nullptr);
-        m_first->setPrev(new_node);
+        BlockTraits::construct(m_block_alloc, block + s_block_size - 1,
+                               std::forward<Args>(args)...);
 
-    } else  { // m_size == 0, very first node in queue
+    } catch (...) {
 
-        assert(m_last == nullptr);
-        m_last = new_node;
+        releaseBlock(block);
+        throw;
     }
 
-    m_first = new_node;
+    m_first_node = (m_first_node - 1) & (m_map_capacity - 1);
+    m_map[m_first_node] = block;
+    ++m_num_blocks;
+
+    m_first_block = block;
+    m_first = block + s_block_size - 1;
     ++m_size;
+
+    return *m_first;
 }
 
-template <typename T>
-void Deque<T>::addLast(const T& item) {
+template <typename T, typename Alloc>
+template <typename... Args>
+T& Deque<T, Alloc>::emplaceLast(Args&&... args) {
+
+    if (m_map == nullptr)
+        initMap();
 
-    Node<T>* new_node{nullptr};
+    T* item{m_last};
+    BlockTraits::construct(m_block_alloc, item, std::forward<Args>(args)...);
+
+    // room remains at the end of the last block
+    if (m_last + 1 != m_last_block + s_block_size) {
+
+        ++m_last;
+        ++m_size;
+        return *item;
+    }
+
+    // otherwise, the last slot of the last block is now in use, and a new
+    // block is required for the position following the last object
+    addLastBlock();
+
+    return *item;
+}
+
+template <typename T, typename Alloc>
+void Deque<T, Alloc>::addLastBlock() {
+
+    T* block{nullptr};
 
     try {
 
-        new_node = new Node<T>(item, nullptr, m_last);
+        if (m_num_blocks == m_map_capacity)
+            growMap();
+
+        block = acquireBlock();
 
     } catch (const std::bad_alloc& e) {
 
-        std::cerr << "Deque::addLast: " << e.what() << '\n';
+        BlockTraits::destroy(m_block_alloc, m_last);
+        std::cerr << "Deque::emplaceLast: " << e.what() << '\n';
         throw;
     }
 
-    if (m_size > 0) {
+    m_map[(m_first_node + m_num_blocks) & (m_map_capacity - 1)] = block;
+    ++m_num_blocks;
 
-        assert(m_last != nullptr);
-        m_last->setNext(new_node);
+    m_last_block = block;
+    m_last = block;
+    ++m_size;
+}
 
-    } else { // m_size == 0, very first node in queue
+template <typename T, typename Alloc>
+T Deque<T, Alloc>::removeFirst() {
 
-        assert(m_first == nullptr);
-        m_first = new_node;
-    }
+    if (m_size == 0)
+        ContainerError::throwEmpty("Deque::removeFirst", "deque");
 
-    m_last = new_node;
-    ++m_size;
+    return takeFirst();
 }
 
-template <typename T>
-T Deque<T>::removeFirst() {
- 
-    if (m_size == 0) {
+template <typename T, typename Alloc>
+std::optional<T> Deque<T, Alloc>::tryRemoveFirst()
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
 
-        std::cerr << "Deque::removeFirst: deque is empty" << '\n';
-        throw std::out_of_range("deque empty, no such element");
-    }
+    if (m_size == 0)
+        return std::nullopt;
+
+    return takeFirst();
+}
 
-    assert(m_first != nullptr && m_last != nullptr);
+template <typename T, typename Alloc>
+T Deque<T, Alloc>::takeFirst() {
 
-    Node<T>* old_node{m_first};
+    assert(m_map != nullptr && m_first != m_last);
 
-    m_first = old_node->next();
+    T item{std::move_if_noexcept(*m_first)};
+    BlockTraits::destroy(m_block_alloc, m_first);
     --m_size;
 
-    if (m_size > 0) {
+    // room remains at the end of the first block
+    if (++m_first != m_first_block + s_block_size)
+        return item;
 
-        assert(m_first != nullptr);
-        m_first->setPrev(nullptr);
+    // otherwise, the first block is now empty; release it
+    removeFirstBlock();
 
-    } else { // m_size == 0, no nodes remain in queue
+    return item;
+}
 
-        assert(m_first == nullptr);
-        m_last = nullptr;
-    }
+template <typename T, typename Alloc>
+void Deque<T, Alloc>::removeFirstBlock() {
 
-    T item = old_node->item();
-    delete old_node;
+    // the first block cannot also be the last block, as m_last never reaches
+    // the end of its block
+    releaseBlock(m_first_block);
+    m_first_node = (m_first_node + 1) & (m_map_capacity - 1);
+    --m_num_blocks;
 
-    return item;
+    m_first_block = m_map[m_first_node];
+    m_first = m_first_block;
 }
 
-template <typename T>
-T Deque<T>::removeLast() {
+template <typename T, typename Alloc>
+template <typename OutputIt>
+OutputIt Deque<T, Alloc>::removeFirstN(int n, OutputIt out) {
+
+    if (n < 0 || n > m_size)
+        ContainerError::throwTooFew("Deque::removeFirstN", "deque", n, m_size);
+
+    while (n > 0) {
+
+        // the objects that remain in the first block, up to n
+        T* block_end{m_first_block == m_last_block ?
+                     m_last : m_first_block + s_block_size};
+        int count{std::min(n, static_cast<int>(block_end - m_first))};
+
+        // a single move of the run of objects; for trivially copyable
+        // objects and a pointer output, a memmove
+        out = std::move(m_first, m_first + count, out);
 
-    if (m_size == 0) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
 
-        std::cerr << "Deque::removeLast: deque is empty" << '\n';
-        throw std::out_of_range("deque empty, no such element");
+            for (T* item{m_first}; item != m_first + count; ++item)
+                BlockTraits::destroy(m_block_alloc, item);
+        }
+
+        m_first += count;
+        m_size -= count;
+        n -= count;
+
+        // the first block is now empty; release it
+        if (m_first == m_first_block + s_block_size)
+            removeFirstBlock();
     }
 
-    assert(m_first != nullptr && m_last != nullptr);
+    return out;
+}
+
+template <typename T, typename Alloc>
+T Deque<T, Alloc>::removeLast() {
 
-    Node<T>* old_node{m_last};
+    if (m_size == 0)
+        ContainerError::throwEmpty("Deque::removeLast", "deque");
 
-    m_last = old_node->prev();
-    --m_size;
+    return takeLast();
+}
 
-    if (m_size > 0) {
+template <typename T, typename Alloc>
+std::optional<T> Deque<T, Alloc>::tryRemoveLast()
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
 
-        assert(m_last != nullptr);
-        m_last->setNext(nullptr);
+    if (m_size == 0)
+        return std::nullopt;
 
-    } else { // m_size == 0, no nodes remain in queue
+    return takeLast();
+}
+
+template <typename T, typename Alloc>
+T Deque<T, Alloc>::takeLast() {
+
+    assert(m_map != nullptr && m_first != m_last);
 
-        assert(m_last == nullptr);
-        m_first = nullptr;
+    // room remains at the beginning of the last block
+    if (m_last != m_last_block) {
+
+        T item{std::move_if_noexcept(*(m_last - 1))};
+        BlockTraits::destroy(m_block_alloc, m_last - 1);
+        --m_last;
+        --m_size;
+
+        return item;
     }
 
-    T item = old_node->item();
-    delete old_node;
+    // otherwise, the last object is at the end of the previous block
+    return removeLastBlock();
+}
+
+template <typename T, typename Alloc>
+T Deque<T, Alloc>::removeLastBlock() {
+
+    // the last block is no longer required once the last object is removed
+    // from the end of the previous block; release it
+    T* block{m_map[(m_first_node + m_num_blocks - 2) & (m_map_capacity - 1)]};
+
+    T item{std::move_if_noexcept(*(block + s_block_size - 1))};
+    BlockTraits::destroy(m_block_alloc, block + s_block_size - 1);
+    --m_size;
+
+    releaseBlock(m_last_block);
+    --m_num_blocks;
+
+    m_last_block = block;
+    m_last = block + s_block_size - 1;
 
     return item;
 }
 
-template <typename T>
-void Deque<T>::clear() {
+template <typename T, typename Alloc>
+T& Deque<T, Alloc>::peekFirst() {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty("Deque::peekFirst", "deque");
+
+    return *m_first;
+}
+
+template <typename T, typename Alloc>
+const T& Deque<T, Alloc>::peekFirst() const {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty("Deque::peekFirst", "deque");
+
+    return *m_first;
+}
+
+template <typename T, typename Alloc>
+T& Deque<T, Alloc>::peekLast() {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty("Deque::peekLast", "deque");
+
+    // the last object is in the last block, unless that block is empty
+    return m_last != m_last_block ? *(m_last - 1) : *pointerTo(m_size - 1);
+}
+
+template <typename T, typename Alloc>
+const T& Deque<T, Alloc>::peekLast() const {
 
-    while (m_first != nullptr) {
+    if (m_size == 0)
+        ContainerError::throwEmpty("Deque::peekLast", "deque");
 
-        Node<T>* node{m_first};
-        m_first = node->next();
-        delete node;
+    // the last object is in the last block, unless that block is empty
+    return m_last != m_last_block ? *(m_last - 1) : *pointerTo(m_size - 1);
+}
+
+template <typename T, typename Alloc>
+T& Deque<T, Alloc>::at(int index) {
+
+    if (index < 0 || index >= m_size)
+        ContainerError::throwOutOfRange("Deque::at", "deque", index);
+
+    return *pointerTo(index);
+}
+
+template <typename T, typename Alloc>
+const T& Deque<T, Alloc>::at(int index) const {
+
+    if (index < 0 || index >= m_size)
+        ContainerError::throwOutOfRange("Deque::at", "deque", index);
+
+    return *pointerTo(index);
+}
+
+template <typename T, typename Alloc>
+void Deque<T, Alloc>::clear() {
+
+    if (m_map == nullptr)
+        return;
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+
+        for (iterator iter{begin()}; iter != end(); ++iter)
+            BlockTraits::destroy(m_block_alloc, &*iter);
+    }
+
+    for (int i{0}; i < m_num_blocks; ++i) {
+
+        int node{(m_first_node + i) & (m_map_capacity - 1)};
+        BlockTraits::deallocate(m_block_alloc, m_map[node], s_block_size);
     }
 
+    if (m_spare != nullptr)
+        BlockTraits::deallocate(m_block_alloc, m_spare, s_block_size);
+
+    MapTraits::deallocate(m_map_alloc, m_map,
+                          static_cast<std::size_t>(m_map_capacity));
+
+    m_map = nullptr;
+    m_map_capacity = 0;
+    m_first_node = 0;
+    m_num_blocks = 0;
+    m_first_block = nullptr;
+    m_first = nullptr;
+    m_last_block = nullptr;
     m_last = nullptr;
     m_size = 0;
+    m_spare = nullptr;
+}
+
+template <typename T, typename Alloc>
+T* Deque<T, Alloc>::acquireBlock() {
+
+    if (m_spare == nullptr)
+        return BlockTraits::allocate(m_block_alloc, s_block_size);
+
+    T* block{m_spare};
+    m_spare = nullptr;
+
+    return block;
+}
+
+template <typename T, typename Alloc>
+void Deque<T, Alloc>::releaseBlock(T* block) {
+
+    if (m_spare == nullptr)
+        m_spare = block;
+    else
+        BlockTraits::deallocate(m_block_alloc, block, s_block_size);
+}
+
+template <typename T, typename Alloc>
+void Deque<T, Alloc>::initMap() {
+
+    assert(m_map == nullptr);
+
+    T* block{nullptr};
+
+    try {
+
+        m_map = MapTraits::allocate(m_map_alloc, s_initial_map_capacity);
+        block = acquireBlock();
+
+    } catch (const std::bad_alloc& e) {
+
+        if (m_map != nullptr)
+            MapTraits::deallocate(m_map_alloc, m_map, s_initial_map_capacity);
+        m_map = nullptr;
+
+        std::cerr << "Deque::initMap: " << e.what() << '\n';
+        throw;
+    }
+
+    m_map[0] = block;
+    m_map_capacity = s_initial_map_capacity;
+    m_first_node = 0;
+    m_num_blocks = 1;
+    m_size = 0;
+
+    // start in the middle of the block, leaving room at either end
+    m_first_block = block;
+    m_first = block + s_block_size / 2;
+    m_last_block = block;
+    m_last = m_first;
+}
+
+template <typename T, typename Alloc>
+void Deque<T, Alloc>::growMap() {
+
+    int new_capacity{2 * m_map_capacity};
+
+    // may throw std::bad_alloc; reported by caller
+    T** new_map{MapTraits::allocate(m_map_alloc,
+                                    static_cast<std::size_t>(new_capacity))};
+
+    // copy blocks in use, in order, to the beginning of the new map; the
+    // blocks themselves do not move, so m_first and m_last remain valid
+    for (int i{0}; i < m_num_blocks; ++i)
+        new_map[i] = m_map[(m_first_node + i) & (m_map_capacity - 1)];
+
+    MapTraits::deallocate(m_map_alloc, m_map,
+                          static_cast<std::size_t>(m_map_capacity));
+    m_map = new_map;
+    m_map_capacity = new_capacity;
+    m_first_node = 0;
 }
 
 #endif // DEQUE_H
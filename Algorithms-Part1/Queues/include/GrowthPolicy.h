@@ -0,0 +1,47 @@
+/**
+ * \file    GrowthPolicy.h
+ * \author  Christine Jones
+ * \brief   Definition of the policy by which a resizable array grows and
+ *          shrinks.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+/**
+ * Policy by which a resizable array, e.g., that of a RandomQueue, changes
+ * capacity. The array's capacity is multiplied by the growth factor when it
+ * is filled, and divided by the growth factor when the array reduces to
+ * 1/shrink_ratio full; a shrink ratio of zero never shrinks the array.
+ *
+ * The shrink ratio must be greater than the growth factor, so that an array
+ * is not full immediately after it shrinks. The gap between the two is the
+ * hysteresis of the policy: after any resize, at least
+ * capacity * (1/growth_factor - 1/shrink_ratio) objects must be added or
+ * removed before the next, so a queue whose size oscillates within that
+ * range is never resized. A larger shrink ratio tolerates larger
+ * oscillations at the cost of more unused memory.
+ */
+struct GrowthPolicy {
+
+    int growth_factor{2};   // multiply capacity when full, divide to shrink
+    int shrink_ratio{4};    // shrink when 1/shrink_ratio full; 0 for never
+
+    /**
+     * Determines if the policy is valid, as described above.
+     */
+    constexpr bool isValid() const
+        { return growth_factor >= 2 &&
+                 (shrink_ratio == 0 || shrink_ratio > growth_factor); }
+
+    /**
+     * Policy that doubles capacity when full, and never shrinks.
+     */
+    static constexpr GrowthPolicy neverShrink() { return {2, 0}; }
+
+};
+
+#endif // GROWTH_POLICY_H
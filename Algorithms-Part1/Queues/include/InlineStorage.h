@@ -0,0 +1,47 @@
+/**
+ * \file    InlineStorage.h
+ * \author  Christine Jones
+ * \brief   Definition of uninitialized storage for a fixed number of objects,
+ *          held within the object that contains it.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef INLINE_STORAGE_H
+#define INLINE_STORAGE_H
+
+#include <cstddef>
+
+/**
+ * Uninitialized storage for N objects of a templated type, suitably aligned,
+ * for a container to hold a small number of objects without allocating
+ * memory. The container constructs and destroys the objects in place. With
+ * N of zero the storage is empty, and data() is null; declare it
+ * [[no_unique_address]] so that it then takes no space.
+ */
+template <typename T, int N>
+class InlineStorage {
+
+public:
+
+    static_assert(N > 0);
+
+    T* data() { return reinterpret_cast<T*>(m_bytes); }
+    const T* data() const { return reinterpret_cast<const T*>(m_bytes); }
+
+private:
+
+    alignas(T) std::byte m_bytes[static_cast<std::size_t>(N) * sizeof(T)];
+};
+
+template <typename T>
+class InlineStorage<T, 0> {
+
+public:
+
+    T* data() { return nullptr; }
+    const T* data() const { return nullptr; }
+};
+
+#endif // INLINE_STORAGE_H
@@ -0,0 +1,85 @@
+/**
+ * \file    InputBuffer.h
+ * \author  Christine Jones
+ * \brief   Definition of class that holds the whole of an input in memory.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef INPUT_BUFFER_H
+#define INPUT_BUFFER_H
+
+#include <cstddef>
+#include <istream>
+#include <string_view>
+#include <vector>
+
+/**
+ * Class that holds the whole of an input in contiguous memory, so that views
+ * of it remain valid for as long as the buffer exists.
+ *
+ * Given a file descriptor of a regular file, the file is mapped into memory,
+ * read only, and pages are read from the file as they are first accessed;
+ * no copy of the input is made. Otherwise, e.g., for a pipe, or where memory
+ * mapping is not available, the input stream is read to its end in large
+ * blocks into a single buffer, which grows as needed.
+ */
+class InputBuffer {
+
+public:
+
+    static constexpr std::size_t s_block_bytes{1 << 20};
+
+    /**
+     * Constructor. Maps, or reads, the whole of the input. An exception of
+     * type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param istream Stream from which the input is read if it is not mapped.
+     * \param int     File descriptor of the same input, e.g., 0 for standard
+     *                input; if negative, the input is not mapped.
+     */
+    explicit InputBuffer(std::istream& input, int fd = -1);
+
+    /**
+     * Destructor. Unmaps, or releases, the input; views of it become invalid.
+     */
+    ~InputBuffer();
+
+    /**
+     * The whole of the input.
+     */
+    std::string_view view() const { return {m_data, m_size}; }
+
+    /**
+     * Number of bytes of input.
+     */
+    std::size_t size() const { return m_size; }
+
+    /**
+     * Determines if the input is mapped into memory, rather than read.
+     */
+    bool isMapped() const { return m_mapped; }
+
+    // copying, assigning a buffer is not supported
+    InputBuffer(const InputBuffer& buffer) = delete;
+    InputBuffer& operator= (const InputBuffer& buffer) = delete;
+
+private:
+
+    // map the file with the given descriptor; returns false if it is not a
+    // regular file, or fails to be mapped
+    bool map(int fd);
+
+    // read the stream to its end
+    void read(std::istream& input);
+
+    const char*       m_data{nullptr};
+    std::size_t       m_size{0};
+    bool              m_mapped{false};
+    std::vector<char> m_buffer{};   // input read, if not mapped
+
+};
+
+#endif // INPUT_BUFFER_H
@@ -0,0 +1,269 @@
+/**
+ * \file    MPMCQueue.h
+ * \author  Christine Jones
+ * \brief   Definition of class that implements a lock-free, bounded,
+ *          multi-producer/multi-consumer queue.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include "CacheLine.h"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>      // for std::forward, std::move
+
+/**
+ * Class that implements a bounded first-in-first-out queue that is safe for
+ * use by any number of producer and consumer threads.
+ *
+ * The queue is implemented as a ring buffer of cells whose capacity is a
+ * power of two, after D. Vyukov's bounded MPMC queue. Each cell carries a
+ * sequence number that records whether the cell is ready to be written by
+ * the producer, or read by the consumer, of a given position. Producers and
+ * consumers claim a position with a single compare-and-swap on the enqueue
+ * or dequeue index respectively, so there are no locks, and a producer never
+ * contends with a consumer except on the same cell. The enqueue and dequeue
+ * indices are kept on separate cache lines.
+ *
+ * A thread that is suspended between claiming a position and completing its
+ * write, or read, delays only the threads that later reach the same cell;
+ * all other threads make progress.
+ *
+ * Adding to a full queue, or removing from an empty queue, fails rather than
+ * blocks; the caller decides whether to spin, yield, or do other work.
+ *
+ * This queue holds objects of a templated type. The templated type must be
+ * nothrow MoveConstructible, so that a claimed cell is always filled.
+ */
+template <typename T>
+class MPMCQueue {
+
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "MPMCQueue: type must be nothrow move constructible");
+
+public:
+
+    /**
+     * Constructor. Initializes an empty queue with at least the given
+     * capacity; the capacity is rounded up to a power of two. An exception of
+     * type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param int Minimum number of objects the queue is able to hold.
+     */
+    explicit MPMCQueue(int capacity);
+
+    /**
+     * Destructor. Destroys any objects remaining in the queue and releases
+     * all memory allocated to the queue. No thread may be using the queue.
+     */
+    ~MPMCQueue();
+
+    /**
+     * Adds an object to the end of the queue.
+     *
+     * \param U Object to be copied, or moved, into the queue.
+     * \return True if added; False if the queue is full.
+     */
+    template <typename U>
+    bool tryEnqueue(U&& item) { return tryEmplace(std::forward<U>(item)); }
+
+    /**
+     * Constructs an object and adds it to the end of the queue. The object is
+     * constructed before a cell is claimed, then moved into the cell, so a
+     * throwing constructor leaves the queue unchanged.
+     *
+     * \param Args Arguments forwarded to the constructor of the object.
+     * \return True if added; False if the queue is full.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    /**
+     * Removes the object at the front of the queue.
+     *
+     * \return Object removed from queue; empty if the queue is empty.
+     */
+    std::optional<T> tryDequeue();
+
+    /**
+     * Number of objects the queue is able to hold.
+     */
+    int capacity() const { return static_cast<int>(m_mask + 1); }
+
+    /**
+     * Number of objects in the queue. Exact only if no thread is using the
+     * queue; otherwise a snapshot that may already be out of date.
+     */
+    int sizeApprox() const;
+
+    // copying, assigning, moving a queue is not supported
+    MPMCQueue(const MPMCQueue& queue) = delete;
+    MPMCQueue& operator= (const MPMCQueue& queue) = delete;
+
+private:
+
+    // a cell holds at most one object, and the sequence number of the
+    // position that may next use the cell
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        alignas(T) std::byte     storage[sizeof(T)];
+
+        T* item() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    using Difference = std::intptr_t;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_enqueue_pos{0};
+    alignas(cache_line_size) std::atomic<std::size_t> m_dequeue_pos{0};
+
+    // read-only after construction
+    alignas(cache_line_size) std::unique_ptr<Cell[]> m_cells{};
+    std::size_t m_mask{0};  // capacity - 1
+
+};
+
+template <typename T>
+MPMCQueue<T>::MPMCQueue(int capacity) {
+
+    assert(capacity > 0);
+
+    std::size_t size{2};
+    while (size < static_cast<std::size_t>(capacity))
+        size *= 2;
+
+    try {
+
+        m_cells = std::make_unique<Cell[]>(size);
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "MPMCQueue::MPMCQueue: " << e.what() << '\n';
+        throw;
+    }
+
+    // cell i is first written by the producer of position i
+    for (std::size_t i{0}; i < size; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+
+    m_mask = size - 1;
+}
+
+template <typename T>
+MPMCQueue<T>::~MPMCQueue() {
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+
+        std::size_t end{m_enqueue_pos.load(std::memory_order_relaxed)};
+        for (std::size_t pos{m_dequeue_pos.load(std::memory_order_relaxed)};
+             pos != end; ++pos)
+            std::destroy_at(m_cells[pos & m_mask].item());
+    }
+}
+
+template <typename T>
+template <typename... Args>
+bool MPMCQueue<T>::tryEmplace(Args&&... args) {
+
+    T item(std::forward<Args>(args)...);
+
+    std::size_t pos{m_enqueue_pos.load(std::memory_order_relaxed)};
+    Cell* cell{nullptr};
+
+    for (;;) {
+
+        cell = &m_cells[pos & m_mask];
+        std::size_t sequence{cell->sequence.load(std::memory_order_acquire)};
+        Difference  diff{static_cast<Difference>(sequence) -
+                         static_cast<Difference>(pos)};
+
+        if (diff == 0) {
+
+            // cell is free for this position; claim the position
+            if (m_enqueue_pos.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed))
+                break;
+
+        } else if (diff < 0) {
+
+            // cell still holds the object of the previous lap; queue is full
+            return false;
+
+        } else {
+
+            // another producer claimed this position; try the latest
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::construct_at(cell->item(), std::move(item));
+
+    // publish the object to the consumer of this position
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+std::optional<T> MPMCQueue<T>::tryDequeue() {
+
+    std::size_t pos{m_dequeue_pos.load(std::memory_order_relaxed)};
+    Cell* cell{nullptr};
+
+    for (;;) {
+
+        cell = &m_cells[pos & m_mask];
+        std::size_t sequence{cell->sequence.load(std::memory_order_acquire)};
+        Difference  diff{static_cast<Difference>(sequence) -
+                         static_cast<Difference>(pos + 1)};
+
+        if (diff == 0) {
+
+            // cell holds the object of this position; claim the position
+            if (m_dequeue_pos.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed))
+                break;
+
+        } else if (diff < 0) {
+
+            // cell not yet written for this position; queue is empty
+            return std::nullopt;
+
+        } else {
+
+            // another consumer claimed this position; try the latest
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::optional<T> item{std::move(*cell->item())};
+    std::destroy_at(cell->item());
+
+    // release the cell to the producer of the next lap
+    cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+    return item;
+}
+
+template <typename T>
+int MPMCQueue<T>::sizeApprox() const {
+
+    std::size_t dequeued{m_dequeue_pos.load(std::memory_order_acquire)};
+    std::size_t enqueued{m_enqueue_pos.load(std::memory_order_acquire)};
+
+    return enqueued > dequeued ? static_cast<int>(enqueued - dequeued) : 0;
+}
+
+#endif // MPMC_QUEUE_H
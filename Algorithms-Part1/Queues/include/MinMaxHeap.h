@@ -0,0 +1,485 @@
+/**
+ * \file    MinMaxHeap.h
+ * \author  Christine Jones
+ * \brief   Definition of class that implements a double-ended priority queue
+ *          as a min-max heap.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef MIN_MAX_HEAP_H
+#define MIN_MAX_HEAP_H
+
+#include "ContainerError.h"
+#include <algorithm>    // for std::max
+#include <bit>          // for std::bit_width
+#include <cassert>
+#include <climits>      // for INT_MAX
+#include <cstddef>
+#include <exception>
+#include <functional>   // for std::less
+#include <iostream>
+#include <iterator>
+#include <memory>       // for std::allocator, std::allocator_traits
+#include <new>
+#include <stdexcept>
+#include <utility>      // for std::forward, std::move, std::swap
+
+/**
+ * Class that implements a double-ended priority queue, from which either the
+ * least or the greatest object may be removed, as a min-max heap, after
+ * Atkinson, Sack, Santoro, and Strothotte, "Min-Max Heaps and Generalized
+ * Priority Queues" (1986).
+ *
+ * A min-max heap is a complete binary tree, stored in an array, whose levels
+ * alternate between min levels and max levels, starting with a min level at
+ * the root: each object on a min level is no greater than any object in its
+ * subtree, and each object on a max level is no less. Hence the least object
+ * is the root, and the greatest is the greater of the root's children. Adding
+ * an object, or removing the least or greatest, is performed in O(log n)
+ * time; peeking at either is constant time. A heap of n objects is built from
+ * a range in O(n) time by heapifying, bottom up.
+ *
+ * The array is uninitialized storage obtained from the given allocator, which
+ * defaults to std::allocator, and grows and shrinks as a RandomQueue does by
+ * default: it doubles in capacity when filled, and is halved when reduced to
+ * a quarter full. No memory is allocated until the first object is added.
+ * As for RandomQueue, when the array is resized each object is moved, unless
+ * the move may throw and a copy is available, so a failed resize leaves the
+ * heap intact.
+ *
+ * This heap holds objects of a templated type, which must be MoveConstructible
+ * and MoveAssignable; it must also be CopyConstructible to add objects by
+ * const reference. The comparison must be a strict weak ordering.
+ */
+template <typename T, typename Compare = std::less<T>,
+          typename Alloc = std::allocator<T>>
+class MinMaxHeap {
+
+public:
+
+    using allocator_type = Alloc;
+
+    /**
+     * Constructor. Initializes an empty heap.
+     *
+     * \param Compare Comparison by which objects are ordered, least first.
+     * \param Alloc   Allocator from which heap memory is obtained.
+     */
+    MinMaxHeap(): MinMaxHeap(Compare{}) {}
+    explicit MinMaxHeap(const Compare& compare, const Alloc& alloc = Alloc{}):
+        m_compare{compare},
+        m_alloc{alloc}
+    {}
+
+    /**
+     * Constructor. Initializes a heap of the objects of the given range, in
+     * time linear in their number. An exception of type std::bad_alloc is
+     * thrown in the case that memory fails to be allocated.
+     *
+     * \param InputIt Iterators to the first and past the last object to be
+     *                copied into the heap.
+     * \param Compare Comparison by which objects are ordered, least first.
+     * \param Alloc   Allocator from which heap memory is obtained.
+     */
+    template <typename InputIt>
+    MinMaxHeap(InputIt first, InputIt last, const Compare& compare = Compare{},
+               const Alloc& alloc = Alloc{});
+
+    /**
+     * Destructor. Releases all memory allocted to the heap.
+     */
+    ~MinMaxHeap() { deleteHeap(); }
+
+    /**
+     * Determine if the heap is empty.
+     *
+     * \return True if no objects in heap; False otherwise.
+     */
+    bool isEmpty() const { return m_size == 0; }
+
+    /**
+     * Returns the number of objects contained in the heap.
+     *
+     * \return Number of objects in heap.
+     */
+    int size() const { return m_size; }
+
+    /**
+     * Adds an object to the heap. An exception of type std::bad_alloc is
+     * thrown in the case that memory fails to be allocated.
+     *
+     * \param T Object to be copied, or moved, into the heap.
+     */
+    void add(const T& item) { emplace(item); }
+    void add(T&& item)      { emplace(std::move(item)); }
+
+    /**
+     * Constructs an object in place and adds it to the heap. An exception of
+     * type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param Args Arguments forwarded to the constructor of the object.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * Methods that return, but do not remove, the least/greatest object of
+     * the heap. An exception of type std::out_of_range is thrown in the case
+     * that the heap is empty.
+     *
+     * \return Reference to the object.
+     */
+    const T& peekMin() const;
+    const T& peekMax() const;
+
+    /**
+     * Methods to remove the least/greatest object of the heap. An exception
+     * of type std::out_of_range is thrown in the case that the heap is empty.
+     *
+     * \return Object removed from heap.
+     */
+    T removeMin();
+    T removeMax();
+
+    /**
+     * Clears all objects from the heap, releasing allocated memory.
+     */
+    void clear() { deleteHeap(); }
+
+    // copying, assigning, moving a heap is not currently supported
+    MinMaxHeap(const MinMaxHeap& heap) = delete;
+    MinMaxHeap& operator= (const MinMaxHeap& heap) = delete;
+
+private:
+
+    static constexpr int s_initial_capacity{8};
+
+    // the root is on level 0, a min level; levels alternate from there
+    static bool isMinLevel(int index)
+        { return (std::bit_width(static_cast<unsigned>(index) + 1) & 1) != 0; }
+
+    static int parent(int index)      { return (index - 1) / 2; }
+    static int grandparent(int index) { return (index - 3) / 4; }
+
+    // order of two objects on a min level (least first), or a max level
+    // (greatest first)
+    template <bool Max>
+    bool before(int a, int b) const {
+        if constexpr (Max)
+            return m_compare(m_heap[b], m_heap[a]);
+        else
+            return m_compare(m_heap[a], m_heap[b]);
+    }
+
+    void swapAt(int a, int b) { using std::swap; swap(m_heap[a], m_heap[b]); }
+
+    // restore the heap order from the given index, upward after an object is
+    // added there, and downward after an object is replaced there
+    void pushUp(int index);
+    template <bool Max>
+    void pushUpLevel(int index);
+    void pushDown(int index);
+    template <bool Max>
+    void pushDownLevel(int index);
+
+    // index of the greatest object; the root, or the greater of its children
+    int maxIndex() const {
+        if (m_size <= 2)
+            return m_size - 1;
+        return m_compare(m_heap[1], m_heap[2]) ? 2 : 1;
+    }
+
+    // remove the object at the given index, filling it with the last object
+    T removeAt(int index);
+
+    // check the heap holds an object before returning one
+    void checkNotEmpty(const char* method) const;
+
+    // manage the heap capacity
+    void resizeHeap(int new_capacity);
+    void deleteHeap();
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    Compare m_compare{};
+    Alloc   m_alloc{};              // allocator of the array
+    T*      m_heap{nullptr};        // array that contains the heap
+    int     m_size{0};              // number of objects currently in the heap
+    int     m_capacity{0};          // number of objects allowed in the heap
+
+};
+
+template <typename T, typename Compare, typename Alloc>
+template <typename InputIt>
+MinMaxHeap<T, Compare, Alloc>::MinMaxHeap(InputIt first, InputIt last,
+                                          const Compare& compare,
+                                          const Alloc& alloc):
+    m_compare{compare},
+    m_alloc{alloc}
+{
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    try {
+
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+
+            auto count{std::distance(first, last)};
+            assert(count <= INT_MAX);
+            if (count > 0)
+                resizeHeap(std::max(static_cast<int>(count),
+                                    s_initial_capacity));
+        }
+
+        for (; first != last; ++first) {
+
+            if (m_size == m_capacity)
+                resizeHeap(std::max(2 * m_capacity, s_initial_capacity));
+            AllocTraits::construct(m_alloc, m_heap + m_size, *first);
+            ++m_size;
+        }
+
+    } catch (...) {
+
+        deleteHeap();
+        throw;
+    }
+
+    // heapify bottom up; the objects below each index are already a heap,
+    // and most indices are near the bottom, so this is linear time
+    for (int i{m_size / 2 - 1}; i >= 0; --i)
+        pushDown(i);
+}
+
+template <typename T, typename Compare, typename Alloc>
+template <typename... Args>
+void MinMaxHeap<T, Compare, Alloc>::emplace(Args&&... args) {
+
+    if (m_size == m_capacity) {
+        try {
+            resizeHeap(std::max(2 * m_capacity, s_initial_capacity));
+
+        } catch (const std::bad_alloc& e) { throw; }
+    }
+
+    AllocTraits::construct(m_alloc, m_heap + m_size,
+                           std::forward<Args>(args)...);
+    ++m_size;
+    pushUp(m_size - 1);
+}
+
+template <typename T, typename Compare, typename Alloc>
+const T& MinMaxHeap<T, Compare, Alloc>::peekMin() const {
+
+    checkNotEmpty("MinMaxHeap::peekMin");
+    return m_heap[0];
+}
+
+template <typename T, typename Compare, typename Alloc>
+const T& MinMaxHeap<T, Compare, Alloc>::peekMax() const {
+
+    checkNotEmpty("MinMaxHeap::peekMax");
+    return m_heap[maxIndex()];
+}
+
+template <typename T, typename Compare, typename Alloc>
+T MinMaxHeap<T, Compare, Alloc>::removeMin() {
+
+    checkNotEmpty("MinMaxHeap::removeMin");
+    return removeAt(0);
+}
+
+template <typename T, typename Compare, typename Alloc>
+T MinMaxHeap<T, Compare, Alloc>::removeMax() {
+
+    checkNotEmpty("MinMaxHeap::removeMax");
+    return removeAt(maxIndex());
+}
+
+template <typename T, typename Compare, typename Alloc>
+T MinMaxHeap<T, Compare, Alloc>::removeAt(int index) {
+
+    T item{std::move(m_heap[index])};
+
+    int last{m_size - 1};
+    if (index != last)
+        m_heap[index] = std::move(m_heap[last]);
+    AllocTraits::destroy(m_alloc, m_heap + last);
+    --m_size;
+
+    if (index < m_size)
+        pushDown(index);
+
+    // shrink when reduced to a quarter full, as RandomQueue does
+    if (m_capacity > s_initial_capacity && m_size <= m_capacity / 4) {
+        try {
+            resizeHeap(std::max(m_capacity / 2, s_initial_capacity));
+
+        } catch (const std::bad_alloc& e) { throw; }
+    }
+
+    return item;
+}
+
+template <typename T, typename Compare, typename Alloc>
+void MinMaxHeap<T, Compare, Alloc>::pushUp(int index) {
+
+    if (index == 0)
+        return;
+
+    // an object out of order with its parent belongs on the parent's levels
+    int p{parent(index)};
+    if (isMinLevel(index)) {
+
+        if (m_compare(m_heap[p], m_heap[index])) {
+            swapAt(index, p);
+            pushUpLevel<true>(p);
+        } else {
+            pushUpLevel<false>(index);
+        }
+
+    } else {
+
+        if (m_compare(m_heap[index], m_heap[p])) {
+            swapAt(index, p);
+            pushUpLevel<false>(p);
+        } else {
+            pushUpLevel<true>(index);
+        }
+    }
+}
+
+template <typename T, typename Compare, typename Alloc>
+template <bool Max>
+void MinMaxHeap<T, Compare, Alloc>::pushUpLevel(int index) {
+
+    // move up through the grandparents, on levels of the same kind
+    while (index > 2) {
+
+        int g{grandparent(index)};
+        if (!before<Max>(index, g))
+            return;
+
+        swapAt(index, g);
+        index = g;
+    }
+}
+
+template <typename T, typename Compare, typename Alloc>
+void MinMaxHeap<T, Compare, Alloc>::pushDown(int index) {
+
+    if (isMinLevel(index))
+        pushDownLevel<false>(index);
+    else
+        pushDownLevel<true>(index);
+}
+
+template <typename T, typename Compare, typename Alloc>
+template <bool Max>
+void MinMaxHeap<T, Compare, Alloc>::pushDownLevel(int index) {
+
+    while (true) {
+
+        int child{2 * index + 1};
+        if (child >= m_size)
+            return;
+
+        // the first among the children and grandchildren, in this level's
+        // order
+        int first{child};
+        if (child + 1 < m_size && before<Max>(child + 1, first))
+            first = child + 1;
+
+        int grandchild{4 * index + 3};
+        int end{std::min(grandchild + 4, m_size)};
+        for (int g{grandchild}; g < end; ++g)
+            if (before<Max>(g, first))
+                first = g;
+
+        if (!before<Max>(first, index))
+            return;
+
+        swapAt(first, index);
+        if (first < grandchild)
+            return;
+
+        // the object moved down to a grandchild may be out of order with
+        // that grandchild's parent, on the other kind of level
+        int p{parent(first)};
+        if (before<Max>(p, first))
+            swapAt(first, p);
+        index = first;
+    }
+}
+
+template <typename T, typename Compare, typename Alloc>
+void MinMaxHeap<T, Compare, Alloc>::checkNotEmpty(const char* method) const {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty(method, "heap");
+}
+
+template <typename T, typename Compare, typename Alloc>
+void MinMaxHeap<T, Compare, Alloc>::resizeHeap(int new_capacity) {
+
+    assert(m_size <= new_capacity);
+
+    T* new_heap{nullptr};
+
+    try {
+
+        new_heap = AllocTraits::allocate(
+                       m_alloc, static_cast<std::size_t>(new_capacity));
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "MinMaxHeap::resizeHeap: " << e.what() << '\n';
+        throw;
+    }
+
+    // move old heap into newly allocated heap; if a move may throw, and a
+    // copy is available, copy instead so the old heap is left intact
+    int moved{0};
+
+    try {
+
+        for (; moved < m_size; ++moved)
+            AllocTraits::construct(m_alloc, new_heap + moved,
+                                   std::move_if_noexcept(m_heap[moved]));
+
+    } catch (...) {
+
+        for (int i{0}; i < moved; ++i)
+            AllocTraits::destroy(m_alloc, new_heap + i);
+        AllocTraits::deallocate(m_alloc, new_heap,
+                                static_cast<std::size_t>(new_capacity));
+        throw;
+    }
+
+    int size{m_size};
+    deleteHeap();
+
+    m_heap = new_heap;
+    m_size = size;
+    m_capacity = new_capacity;
+}
+
+template <typename T, typename Compare, typename Alloc>
+void MinMaxHeap<T, Compare, Alloc>::deleteHeap() {
+
+    if (m_heap == nullptr)
+        return;
+
+    for (int i{0}; i < m_size; ++i)
+        AllocTraits::destroy(m_alloc, m_heap + i);
+
+    AllocTraits::deallocate(m_alloc, m_heap,
+                            static_cast<std::size_t>(m_capacity));
+    m_heap = nullptr;
+    m_size = 0;
+    m_capacity = 0;
+}
+
+#endif // MIN_MAX_HEAP_H
@@ -0,0 +1,261 @@
+/**
+ * \file    MonotonicDeque.h
+ * \author  Christine Jones
+ * \brief   Definition of class that maintains the minimum or maximum of a
+ *          sliding window of objects.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef MONOTONIC_DEQUE_H
+#define MONOTONIC_DEQUE_H
+
+#include "ContainerError.h"
+#include "Deque.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>   // for std::less
+#include <iostream>
+#include <new>
+#include <span>
+#include <stdexcept>
+
+/**
+ * Class that maintains the extreme, i.e., the minimum or maximum, of a
+ * window of objects that slides over a stream: objects are pushed at the
+ * back of the window and popped from the front, in first-in first-out order,
+ * and front() returns the extreme of the objects in the window.
+ *
+ * The objects are held in a Deque in monotonic order: an object is only kept
+ * while no later object in the window is at least as extreme, since such an
+ * object can never again be the extreme of the window. Pushing an object
+ * first removes, from the back of the deque, every object that it replaces,
+ * and popping removes the front of the deque only if it is the oldest object
+ * of the window. Every object is added to and removed from the deque at most
+ * once, so push and pop are each performed in constant amortized time, and
+ * front() in constant worst-case time; rescanning the window for its extreme
+ * takes time linear in the width of the window.
+ *
+ * As with std::priority_queue, the comparison orders objects from least to
+ * most extreme: std::less, the default, maintains the maximum, and
+ * std::greater the minimum. Of equal objects, the latest pushed is kept.
+ *
+ * This class holds objects of a templated type, which must be
+ * CopyConstructible; the comparison must be a strict weak ordering.
+ */
+template <typename T, typename Compare = std::less<T>>
+class MonotonicDeque {
+
+public:
+
+    /**
+     * Constructor. Initializes an empty window.
+     *
+     * \param Compare Comparison that orders objects from least to most
+     *                extreme.
+     */
+    MonotonicDeque(): MonotonicDeque(Compare{}) {}
+    explicit MonotonicDeque(const Compare& compare): m_compare{compare} {}
+
+    /**
+     * Determine if the window is empty.
+     *
+     * \return True if no objects in window; False otherwise.
+     */
+    bool isEmpty() const { return m_pushed == m_popped; }
+
+    /**
+     * Returns the number of objects in the window, which may exceed the
+     * number of objects held.
+     *
+     * \return Number of objects in window.
+     */
+    int size() const { return static_cast<int>(m_pushed - m_popped); }
+
+    /**
+     * Adds object to the back of the window. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     * Should the object fail to be added, for this or any other reason, the
+     * window is cleared, since objects it outranked may already have been
+     * discarded.
+     *
+     * \param T Object to be copied into the window.
+     */
+    void push(const T& item);
+
+    /**
+     * Removes the oldest object from the front of the window. An exception of
+     * type std::out_of_range is thrown in the case that the window is empty.
+     */
+    void pop();
+
+    /**
+     * Returns the extreme of the objects in the window. An exception of type
+     * std::out_of_range is thrown in the case that the window is empty.
+     *
+     * \return Reference to the most extreme object.
+     */
+    const T& front() const;
+
+    /**
+     * Slides a window of the given width over the given objects, after any
+     * objects already in the window, and writes the extreme of the window to
+     * the given span each time the window holds the given number of objects.
+     * Objects are popped as the window slides, so the window holds at most
+     * width objects on return, and a stream may be processed a span at a
+     * time. An exception of type std::bad_alloc is thrown in the case that
+     * memory fails to be allocated; as with push(), the window is then
+     * cleared.
+     *
+     * \param span Objects to be pushed, in order.
+     * \param int  Width of the window; must be greater than zero, and no less
+     *             than the number of objects already in the window.
+     * \param span Extremes of the window, one per object pushed once the
+     *             window is full; must hold as many objects as are pushed.
+     *
+     * \return int Number of extremes written.
+     */
+    int slide(std::span<const T> items, int width, std::span<T> extremes);
+
+    /**
+     * Clears all objects from the window.
+     */
+    void clear();
+
+    // copying, assigning a window is not supported
+    MonotonicDeque(const MonotonicDeque& window) = delete;
+    MonotonicDeque& operator= (const MonotonicDeque& window) = delete;
+
+private:
+
+    // an object held, with the number of objects pushed before it
+    struct Entry {
+        T             item;
+        std::uint64_t index{0};
+    };
+
+    // remove the objects that the given object replaces, then add it
+    void pushEntry(const T& item);
+
+    // remove the oldest object of the window, if it is still held
+    void popEntry();
+
+    Deque<Entry>  m_entries{};  // objects held, in monotonic order
+    Compare       m_compare{};
+    std::uint64_t m_pushed{0};  // number of objects pushed
+    std::uint64_t m_popped{0};  // number of objects popped
+};
+
+template <typename T, typename Compare>
+void MonotonicDeque<T, Compare>::push(const T& item) {
+
+    try {
+
+        pushEntry(item);
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "MonotonicDeque::push: " << e.what() << '\n';
+        throw;
+    }
+}
+
+template <typename T, typename Compare>
+void MonotonicDeque<T, Compare>::pop() {
+
+    if (isEmpty())
+        ContainerError::throwEmpty("MonotonicDeque::pop", "window");
+
+    popEntry();
+}
+
+template <typename T, typename Compare>
+const T& MonotonicDeque<T, Compare>::front() const {
+
+    if (isEmpty())
+        ContainerError::throwEmpty("MonotonicDeque::front", "window");
+
+    return m_entries.peekFirst().item;
+}
+
+template <typename T, typename Compare>
+int MonotonicDeque<T, Compare>::slide(std::span<const T> items, int width,
+                                      std::span<T> extremes) {
+
+    assert(width > 0 && size() <= width);
+
+    int written{0};
+
+    try {
+
+        for (const T& item : items) {
+
+            pushEntry(item);
+
+            if (size() > width)
+                popEntry();
+
+            if (size() == width) {
+
+                assert(written < static_cast<int>(extremes.size()));
+                extremes[static_cast<std::size_t>(written++)] =
+                    m_entries.peekFirst().item;
+            }
+        }
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "MonotonicDeque::slide: " << e.what() << '\n';
+        throw;
+    }
+
+    return written;
+}
+
+template <typename T, typename Compare>
+void MonotonicDeque<T, Compare>::clear() {
+
+    m_entries.clear();
+    m_pushed = 0;
+    m_popped = 0;
+}
+
+template <typename T, typename Compare>
+void MonotonicDeque<T, Compare>::pushEntry(const T& item) {
+
+    try {
+
+        // an object held that is no more extreme than the new object can
+        // never again be the extreme of the window
+        while (!m_entries.isEmpty() &&
+               !m_compare(item, m_entries.peekLast().item))
+            m_entries.removeLast();
+
+        m_entries.addLast(Entry{item, m_pushed});
+
+    } catch (...) {
+
+        // the objects already removed may have held the extreme of the
+        // window, which can no longer be found; start over with an empty
+        // window
+        clear();
+        throw;
+    }
+
+    ++m_pushed;
+}
+
+template <typename T, typename Compare>
+void MonotonicDeque<T, Compare>::popEntry() {
+
+    // the oldest object is held only if no later object replaced it, in
+    // which case it is at the front of the deque
+    if (m_entries.peekFirst().index == m_popped)
+        m_entries.removeFirst();
+    ++m_popped;
+}
+
+#endif // MONOTONIC_DEQUE_H
@@ -0,0 +1,171 @@
+/**
+ * \file    PoolAllocator.h
+ * \author  Christine Jones
+ * \brief   Definition of a fixed-size chunk pool, and an allocator that
+ *          serves allocations from that pool.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>       // for std::shared_ptr
+#include <new>
+#include <vector>
+
+/**
+ * Class that implements a pool of fixed-size chunks of memory. Chunks are
+ * carved from large slabs obtained from the global heap, and released chunks
+ * are kept on a free list for reuse; slabs are only returned to the global
+ * heap when the pool is destroyed. Once a pool has grown to the peak number
+ * of chunks in use, allocating and releasing chunks never calls into the
+ * global heap.
+ *
+ * Requests larger than the chunk size are passed through to the global heap,
+ * and counted, so that a client can verify that its allocations are served
+ * by the pool.
+ *
+ * A pool is not thread safe. Multi-threaded clients should use a pool per
+ * thread, which also avoids contention on the global heap.
+ */
+class BlockPool {
+
+public:
+
+    /**
+     * Constructor. No memory is allocated until the first chunk is requested.
+     *
+     * \param std::size_t Size of each chunk in bytes; rounded up to a multiple
+     *                    of the fundamental alignment.
+     * \param std::size_t Number of chunks carved from each slab.
+     */
+    BlockPool(std::size_t chunk_bytes, std::size_t chunks_per_slab);
+
+    /**
+     * Destructor. Releases all slabs to the global heap. All chunks must have
+     * been released to the pool.
+     */
+    ~BlockPool();
+
+    /**
+     * Allocate the given number of bytes; from the pool if no larger than the
+     * chunk size, otherwise from the global heap. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     */
+    void* allocate(std::size_t bytes);
+
+    /**
+     * Release memory previously allocated with the given number of bytes.
+     */
+    void deallocate(void* ptr, std::size_t bytes) noexcept;
+
+    /**
+     * Pool statistics.
+     */
+    std::size_t chunkBytes() const  { return m_chunk_bytes; }
+    int         slabs() const       { return static_cast<int>(m_slabs.size()); }
+    int         chunksInUse() const { return m_chunks_in_use; }
+    int         heapFallbacks() const { return m_heap_fallbacks; }
+
+    // copying, assigning, moving a pool is not supported
+    BlockPool(const BlockPool& pool) = delete;
+    BlockPool& operator= (const BlockPool& pool) = delete;
+
+private:
+
+    // released chunks are linked through their own storage
+    struct FreeChunk {
+        FreeChunk* next{nullptr};
+    };
+
+    // carve a new slab into chunks on the free list
+    void addSlab();
+
+    std::size_t        m_chunk_bytes{0};        // size of each chunk
+    std::size_t        m_chunks_per_slab{0};    // number of chunks per slab
+    FreeChunk*         m_free{nullptr};         // free list of chunks
+    std::vector<void*> m_slabs{};               // slabs allocated
+    int                m_chunks_in_use{0};      // chunks allocated
+    int                m_heap_fallbacks{0};     // requests passed to heap
+
+};
+
+/**
+ * Allocator that serves allocations from a shared BlockPool. Copies of an
+ * allocator, including copies rebound to another type, share the same pool,
+ * which lives until the last copy is destroyed.
+ *
+ * Sized to the blocks of a container, e.g., Deque<T>::block_bytes, every
+ * block the container allocates is served by the pool; smaller allocations,
+ * such as a small block map, also use a chunk each.
+ */
+template <typename T>
+class PoolAllocator {
+
+public:
+
+    using value_type = T;
+
+    static constexpr std::size_t default_chunk_bytes{1024};
+    static constexpr std::size_t default_chunks_per_slab{64};
+
+    /**
+     * Constructor. Creates a new pool. An exception of type std::bad_alloc is
+     * thrown in the case that memory fails to be allocated.
+     *
+     * \param std::size_t Size of each chunk in bytes.
+     * \param std::size_t Number of chunks carved from each slab.
+     */
+    explicit PoolAllocator(
+        std::size_t chunk_bytes = default_chunk_bytes,
+        std::size_t chunks_per_slab = default_chunks_per_slab):
+        m_pool{std::make_shared<BlockPool>(chunk_bytes, chunks_per_slab)}
+    {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept:
+        m_pool{other.pool()}
+    {}
+
+    /**
+     * Allocate uninitialized memory for the given number of objects. An
+     * exception of type std::bad_alloc is thrown in the case that memory
+     * fails to be allocated.
+     */
+    T* allocate(std::size_t n) {
+
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "PoolAllocator: over-aligned types are not supported");
+
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length{};
+
+        return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+    }
+
+    /**
+     * Release memory previously allocated for the given number of objects.
+     */
+    void deallocate(T* ptr, std::size_t n) noexcept
+        { m_pool->deallocate(ptr, n * sizeof(T)); }
+
+    /**
+     * The pool shared by this allocator; also provides pool statistics.
+     */
+    const std::shared_ptr<BlockPool>& pool() const noexcept { return m_pool; }
+
+    template <typename U>
+    friend bool operator==(const PoolAllocator& a, const PoolAllocator<U>& b)
+        { return a.m_pool == b.pool(); }
+
+private:
+
+    std::shared_ptr<BlockPool> m_pool{};
+
+};
+
+#endif // POOL_ALLOCATOR_H
@@ -1,7 +1,7 @@
 /**
  * \file    Random.h
  * \author  Christine Jones 
- * \brief   
+ * \brief   Random namespace; uniformly distributed random numbers.
  *
  * \copyright 2024
  * \license   GNU GENERAL PUBLIC LICENSE version 3 
@@ -10,8 +10,147 @@
 #ifndef RANDOM_H
 #define RANDOM_H
 
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <span>
+
 namespace Random {
 
+/**
+ * Random number engine xoshiro256** of Blackman and Vigna, "Scrambled Linear
+ * Pseudorandom Number Generators" (2021). Generates 64 random bits per call
+ * from 256 bits of state, with a period of 2^256 - 1; much faster, and with
+ * much smaller state, than std::mt19937. Meets the requirements of a
+ * UniformRandomBitGenerator, so may be used with the standard distributions.
+ */
+class Xoshiro256 {
+
+public:
+
+    using result_type = std::uint64_t;
+
+    /**
+     * Constructor. Seeds the engine from the given value; the 256 bits of
+     * state are expanded from the seed with splitmix64.
+     *
+     * \param uint64_t Seed.
+     */
+    explicit Xoshiro256(std::uint64_t seed_value = 0) { seed(seed_value); }
+
+    void seed(std::uint64_t seed_value) {
+
+        for (std::uint64_t& s : m_state) {
+            seed_value += 0x9e3779b97f4a7c15ULL;
+            std::uint64_t z{seed_value};
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            s = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max()
+        { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+
+        result_type result{rotl(m_state[1] * 5, 7) * 9};
+        result_type t{m_state[1] << 17};
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+
+        return result;
+    }
+
+private:
+
+    static result_type rotl(result_type x, int k)
+        { return (x << k) | (x >> (64 - k)); }
+
+    result_type m_state[4]{};
+};
+
+/**
+ * Returns a random number in [0, range), using a uniform distribution, by
+ * Lemire's multiply-shift method, "Fast Random Integer Generation in an
+ * Interval" (2019): the high half of the product of 32 random bits and the
+ * range, rejecting a product only in the rare case that its low half falls
+ * in the small biased region. Unlike std::uniform_int_distribution, needs no
+ * division except in that case.
+ *
+ * \param URBG     Engine producing at least 32 random bits per call.
+ * \param uint32_t Size of the range; must be greater than zero.
+ *
+ * \return uint32_t Number in [0, range).
+ */
+template <typename URBG>
+std::uint32_t boundedNumber(URBG& gen, std::uint32_t range) {
+
+    using Result = typename URBG::result_type;
+    static_assert(std::numeric_limits<Result>::digits >= 32,
+                  "Random::boundedNumber: engine must produce 32 bits");
+    static_assert(URBG::min() == 0 &&
+                  URBG::max() == std::numeric_limits<Result>::max(),
+                  "Random::boundedNumber: engine must produce full words");
+
+    // the high 32 bits, which are the best quality bits of most engines
+    constexpr int shift{std::numeric_limits<Result>::digits - 32};
+
+    assert(range > 0);
+
+    std::uint64_t product{static_cast<std::uint64_t>(
+                              static_cast<std::uint32_t>(gen() >> shift)) *
+                          range};
+    std::uint32_t low{static_cast<std::uint32_t>(product)};
+
+    if (low < range) {
+
+        // 2^32 mod range; products whose low half is below it are biased
+        std::uint32_t threshold{static_cast<std::uint32_t>(-range) % range};
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(
+                          static_cast<std::uint32_t>(gen() >> shift)) *
+                      range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+/**
+ * Returns a random real number in the open interval (0, 1), using a uniform
+ * distribution; never zero, so that its logarithm is finite.
+ *
+ * \param URBG Engine producing 64 random bits per call.
+ *
+ * \return double Number between 0 and 1, exclusive.
+ */
+template <typename URBG>
+double realNumber(URBG& gen) {
+
+    using Result = typename URBG::result_type;
+    static_assert(std::numeric_limits<Result>::digits == 64 &&
+                  URBG::min() == 0 &&
+                  URBG::max() == std::numeric_limits<Result>::max(),
+                  "Random::realNumber: engine must produce 64 bits");
+
+    // 53 random bits, the precision of a double, offset by half a step
+    return (static_cast<double>(gen() >> 11) + 0.5) * 0x1.0p-53;
+}
+
+/**
+ * Engine from which the functions of this namespace draw; seeded from
+ * std::random_device. Not safe for use by multiple threads at once.
+ */
+extern Xoshiro256 genXoshiro;
+
 /**
  * Returns a random number between the given min and max, inclusive, using a
  * uniform distribution.
@@ -21,7 +160,46 @@ namespace Random {
  * 
  * \return int Number between given min and max, inclusive.
  */
-int getRandomNumber(int min, int max);
+inline int getRandomNumber(int min, int max) {
+
+    assert(min <= max);
+
+    std::uint32_t range{static_cast<std::uint32_t>(
+                            static_cast<std::int64_t>(max) - min + 1)};
+
+    // the full range of int has 2^32 numbers, which wraps range to zero
+    std::uint32_t offset{range == 0 ?
+                         static_cast<std::uint32_t>(genXoshiro() >> 32) :
+                         boundedNumber(genXoshiro, range)};
+
+    return static_cast<int>(static_cast<std::int64_t>(min) + offset);
+}
+
+/**
+ * Returns a random real number in the open interval (0, 1), using a uniform
+ * distribution; never zero, so that its logarithm is finite.
+ *
+ * \return double Number between 0 and 1, exclusive.
+ */
+inline double getRandomReal() { return realNumber(genXoshiro); }
+
+/**
+ * Fills the given array with random numbers between the given min and max,
+ * inclusive, using a uniform distribution; equivalent to, but faster than,
+ * calling getRandomNumber() for each.
+ *
+ * \param int       Minimum number.
+ * \param int       Maximum number; must be greater or equal to minimum number.
+ * \param span<int> Array to be filled.
+ */
+void getRandomNumbers(int min, int max, std::span<int> numbers);
+
+/**
+ * Reseeds the engine, e.g., to reproduce a sequence of random numbers.
+ *
+ * \param uint64_t Seed.
+ */
+void seed(std::uint64_t seed_value);
 
 } // namespace Random
 
@@ -10,14 +10,23 @@
 #ifndef RANDOM_QUEUE_H
 #define RANDOM_QUEUE_H
 
+#include "ContainerError.h"
+#include "GrowthPolicy.h"
+#include "InlineStorage.h"
 #include "Random.h"
-#include <algorithm>    // for std::swap
+#include <algorithm>    // for std::max, std::swap
 #include <cassert>
+#include <climits>      // for INT_MAX
 #include <cstddef>      // for std::ptrdiff_t
+#include <cstdint>
 #include <exception>
 #include <iostream>
 #include <iterator>
-#include <numeric>
+#include <memory>       // for std::allocator, std::allocator_traits
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>      // for std::forward, std::move
 #include <vector>
 
 /**
@@ -25,28 +34,55 @@
  * is similar to a standard queue except that objects removed are chosen
  * uniformly at random among all the objects in the queue.
  * 
- * This randomized queue is implemented as a resizable array. The array doubles
- * in capacity when filled. Its capacity is halved when the array reduces to a 
- * quarter full. Each randomized queue operation (besides creating an iterator)
- * is performed in constant amortized time.
+ * This randomized queue is implemented as a resizable array. By default, the
+ * array doubles in capacity when filled, and its capacity is halved when the
+ * array reduces to a quarter full; a different GrowthPolicy, e.g., one that
+ * never shrinks, may be given on construction. Each randomized queue
+ * operation (besides creating an iterator) is performed in constant
+ * amortized time. The capacity may also be set directly with reserve() and
+ * shrinkToFit().
  * 
  * Objects are added and stored to the array in a uniformly random order.
  * Therefore, removing an object at random is simply met by returning the
  * last object on the queue.
  * 
+ * The array is uninitialized storage obtained from the given allocator, which
+ * defaults to std::allocator. Objects are constructed in place when added and
+ * destroyed when removed; when the array is resized, each object is moved into
+ * the new array and the old object destroyed. No object is default constructed.
+ *
+ * Given an inline capacity N greater than zero, the queue holds up to N
+ * objects in storage within the queue itself, and allocates no memory until
+ * it grows beyond N objects; it returns to the inline storage once it
+ * shrinks back to N. The queue then never shrinks below N objects, and
+ * SmallRandomQueue<T, N> names such a queue.
+ *
  * This randomized queue holds objects of a templated type. The templated type
- * must be CopyAssignable and CopyConstructible.
+ * must be MoveConstructible and MoveAssignable; it must also be
+ * CopyConstructible to add objects by const reference. Objects are moved,
+ * rather than copied, within the queue and out of the queue when removed.
  */
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>, int N = 0>
 class RandomQueue {
 
 public:
 
     /**
      * Custom iterator that allows for a single pass over the queue. Each
-     * iterator instance returns the elements of the queue in uniformly random
-     * order. The order of two or more iterators to the same randomized queue
-     * is mutually independent; each iterator maintains its own random order.
+     * iterator instance returns the elements of the queue in random order.
+     * The order of two or more iterators to the same randomized queue is
+     * mutually independent; each iterator maintains its own random order.
+     *
+     * The order is generated lazily, without an array of indices: the
+     * iterator steps through positions [0, size) and maps each position to
+     * an index of the queue by a keyed Feistel network, a bijection over the
+     * smallest power of four at least size; an index outside the queue is
+     * mapped again until it falls inside (cycle walking), so each object is
+     * returned exactly once. Creating an iterator takes constant time and
+     * memory, and each increment takes expected constant time. The order is
+     * pseudorandom: each object is close to equally likely at each position,
+     * but, for a large queue, only a small fraction of all possible orders
+     * can be produced.
      */
     class iter {
     public:
@@ -65,21 +101,24 @@ public:
         iter(const T* array, int size, bool random = true):
             m_array{array},
             m_index{size - 1},
-            m_indices{std::vector<int>(static_cast<std::size_t>(size))}
+            m_size{size},
+            m_random{random}
         {
-            std::iota(m_indices.begin(), m_indices.end(), 0);
-            if (random)
+            if (m_random)
                 randomize();
+            m_current = permute(m_index);
         }
 
         static iter end() { return iter{}; }
 
-        reference operator*() const
-            { return m_array[m_indices[static_cast<std::size_t>(m_index)]]; }
-        pointer operator->() const
-            { return &m_array[m_indices[static_cast<std::size_t>(m_index)]]; }
+        reference operator*() const { return m_array[m_current]; }
+        pointer operator->() const  { return &m_array[m_current]; }
 
-        iter& operator++() { --m_index; return *this; }
+        iter& operator++() {
+            if (--m_index >= 0)
+                m_current = permute(m_index);
+            return *this;
+        }
 
         friend bool operator==(const iter& a, const iter& b) 
             { return a.m_index == b.m_index; }
@@ -92,29 +131,103 @@ public:
 
     private:
 
+        // rounds of the Feistel network; four rounds are enough for any one
+        // position, but cycle walking over a small queue depends on the
+        // whole permutation, which needs more rounds to be close to uniform
+        static constexpr int      s_max_rounds{12};
+        static constexpr int      s_large_rounds{6};
+        static constexpr unsigned s_large_half_bits{5};
+
+        // choose the width of the network and a random key for each round
         void randomize() {
 
-            for (int i{0};
-                 static_cast<std::size_t>(i) < m_indices.size();
-                 ++i) {
+            while ((std::uint64_t{1} << (2 * m_half_bits)) <
+                   static_cast<std::uint64_t>(m_size))
+                ++m_half_bits;
+            m_half_mask = (std::uint32_t{1} << m_half_bits) - 1;
+            m_rounds = m_half_bits < s_large_half_bits ? s_max_rounds
+                                                       : s_large_rounds;
+
+            // expand a single random seed into the round keys (splitmix64)
+            std::uint64_t seed{Random::genXoshiro()};
+
+            for (int i{0}; i < m_rounds; ++i) {
+                seed += 0x9e3779b97f4a7c15ULL;
+                std::uint64_t z{seed};
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                m_keys[i] = static_cast<std::uint32_t>(z ^ (z >> 31));
+            }
+        }
+
+        // index of the queue at the given position of this iterator's order
+        int permute(int position) const {
+
+            if (!m_random || position < 0)
+                return position;
+
+            std::uint32_t x{static_cast<std::uint32_t>(position)};
+            do {
+                x = feistel(x);
+            } while (x >= static_cast<std::uint32_t>(m_size));
+
+            return static_cast<int>(x);
+        }
 
-                int r{Random::getRandomNumber(0, i)};
-                std::swap(m_indices[static_cast<std::size_t>(r)],
-                          m_indices[static_cast<std::size_t>(i)]);
+        // bijection over [0, 4^half_bits); each round swaps the halves and
+        // mixes a keyed hash of one half into the other
+        std::uint32_t feistel(std::uint32_t x) const {
+
+            std::uint32_t left{x >> m_half_bits};
+            std::uint32_t right{x & m_half_mask};
+
+            for (int i{0}; i < m_rounds; ++i) {
+                std::uint32_t mixed{left ^
+                                    (mix(right ^ m_keys[i]) & m_half_mask)};
+                left = right;
+                right = mixed;
             }
+
+            return (left << m_half_bits) | right;
         }
 
-        const T*         m_array{nullptr};
-        int              m_index{-1};
-        std::vector<int> m_indices{};
+        // 32-bit finalizer of MurmurHash3
+        static std::uint32_t mix(std::uint32_t h) {
+            h ^= h >> 16;
+            h *= 0x85ebca6bU;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35U;
+            h ^= h >> 16;
+            return h;
+        }
+
+        const T*      m_array{nullptr};
+        int           m_index{-1};
+        int           m_current{-1};
+        int           m_size{0};
+        bool          m_random{false};
+        unsigned      m_half_bits{0};
+        std::uint32_t m_half_mask{0};
+        int           m_rounds{0};
+        std::uint32_t m_keys[s_max_rounds]{};
     };
     typedef iter const_iterator;
 
+    using allocator_type = Alloc;
+
     /**
      * Constructor. Initializes an empty queue. An exception of type
      * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     *
+     * \param GrowthPolicy Policy by which the array grows and shrinks; must
+     *                     be valid.
+     * \param Alloc        Allocator from which queue memory is obtained.
      */
-    RandomQueue();
+    RandomQueue(): RandomQueue(GrowthPolicy{}, Alloc{}) {}
+    explicit RandomQueue(const Alloc& alloc):
+        RandomQueue(GrowthPolicy{}, alloc) {}
+    explicit RandomQueue(const GrowthPolicy& policy,
+                         const Alloc& alloc = Alloc{});
 
     /**
      * Destructor. Releases all memory allocted to the queue.
@@ -137,21 +250,73 @@ public:
 
     /**
      * Returns the current capacity of the queue. The capacity does grow and
-     * shrink with the use of the queue. This accessor is made availble for
-     * testing purposes.
+     * shrink with the use of the queue, according to its growth policy.
      * 
      * \return Total number of objects that are able to currently be stored
      *         in the queue.
      */
     int capacity() const { return m_capacity; }
 
+    /**
+     * Determine if the objects of the queue are held in its inline storage,
+     * rather than in allocated memory; always false for no inline capacity.
+     */
+    bool isInline() const { return N > 0 && m_queue == m_inline.data(); }
+
+    /**
+     * Returns the policy by which the queue grows and shrinks.
+     */
+    const GrowthPolicy& growthPolicy() const { return m_policy; }
+
+    /**
+     * Increases the capacity of the queue to at least the given number of
+     * objects, so that adding objects up to that number does not resize the
+     * array. The queue does not shrink below the reserved capacity until
+     * shrinkToFit() or clear() is called. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param int Number of objects; must not be negative.
+     */
+    void reserve(int capacity);
+
+    /**
+     * Reduces the capacity of the queue to its size, or the initial capacity
+     * if greater, and releases any reserved capacity. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     */
+    void shrinkToFit();
+
     /**
      * Adds an object to the queue. An exception of type std::bad_alloc is
      * thrown in the case that memory fails to be allocated.
      *
-     * \param T Object to be added to the queue.
+     * \param T Object to be copied, or moved, into the queue.
      */
-    void enqueue(const T& item);
+    void enqueue(const T& item) { emplace(item); }
+    void enqueue(T&& item)      { emplace(std::move(item)); }
+
+    /**
+     * Constructs an object in place and adds it to the queue. An exception of
+     * type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param Args Arguments forwarded to the constructor of the object.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * Adds each object of the given range to the queue. For a forward range
+     * the array is resized at most once, to fit all the objects. An exception
+     * of type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param InputIt Iterators to the first and past the last object to be
+     *                copied into the queue.
+     */
+    template <typename InputIt>
+    void enqueueRange(InputIt first, InputIt last);
 
     /**
      * Removes a random object from the queue. An exception of type
@@ -161,6 +326,46 @@ public:
      */
     T dequeue();
 
+    /**
+     * Removes a random object from the queue, if any. Nothing is logged or
+     * thrown in the case that the queue is empty. Should the array fail to
+     * shrink, the queue keeps its larger array; so unless the object's move
+     * constructor may throw, nothing is thrown at all.
+     *
+     * \return Object removed from queue; empty if the queue is empty.
+     */
+    std::optional<T> tryDequeue()
+        noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * Removes k random objects from the queue, in random order, and writes
+     * them to the given output. The array is resized at most once, after all
+     * objects are removed. An exception of type std::out_of_range is thrown,
+     * and no object removed, in the case that k is negative or the queue
+     * holds fewer than k objects.
+     *
+     * \param int      Number of objects to remove.
+     * \param OutputIt Destination to which removed objects are moved.
+     *
+     * \return OutputIt Destination past the last object written.
+     */
+    template <typename OutputIt>
+    OutputIt dequeueN(int k, OutputIt out);
+
+    /**
+     * Copies k distinct random objects of the queue, in random order, to the
+     * given output, without removing them. Draws k random numbers. An
+     * exception of type std::out_of_range is thrown in the case that k is
+     * negative or the queue holds fewer than k objects.
+     *
+     * \param int      Number of objects to sample.
+     * \param OutputIt Destination to which sampled objects are copied.
+     *
+     * \return OutputIt Destination past the last object written.
+     */
+    template <typename OutputIt>
+    OutputIt sampleK(int k, OutputIt out);
+
     /**
      * Methods that return, but do not remove, a random object from the queue.
      * An exception of type std::out_of_range is thrown in the case that the
@@ -197,56 +402,108 @@ public:
 
 private:
 
-    static constexpr int s_initial_capacity{2};
-    static constexpr int s_resize_rate{2};  // double/halve capacity
-    static constexpr int s_shrink_ratio{4}; // shrink at 1/4 capacity
+    // the inline capacity, if any, is the initial capacity
+    static constexpr int s_initial_capacity{N > 0 ? N : 2};
 
     // queue needs to grow when capacity is full
     bool needToGrow() const
         { return m_size == m_capacity; }
 
-    // queue needs to shrink when reduced to quarter capacity
+    // queue needs to shrink when reduced to the policy's fraction of
+    // capacity, unless the capacity is reserved
     bool needToShrink() const
-        { return (m_capacity > s_initial_capacity) && 
-                 (m_size == (m_capacity / s_shrink_ratio)); }
+        { return (m_policy.shrink_ratio > 0) &&
+                 (m_capacity > minCapacity()) &&
+                 (m_size <= (m_capacity / m_policy.shrink_ratio)); }
 
-    // manage the queue capacity
+    // capacity below which the queue does not shrink
+    int minCapacity() const
+        { return std::max(s_initial_capacity, m_reserved); }
+
+    // manage the queue capacity; a failure to allocate is logged to
+    // std::cerr, unless log is false, and std::bad_alloc rethrown
     void growQueue();
-    void shrinkQueue();
-    void resizeQueue(int new_capacity);
+    void shrinkQueue(bool log = true);
+    void resizeQueue(int new_capacity, bool log = true);
+
+    // resize once to the capacity that repeated single additions, or
+    // removals, would have reached at the current size plus the given number
+    // of objects to be added
+    void reserveFor(int count);
+    void shrinkAfterRemoval();
+
+    // add an object already constructed at the end of the array, swapping
+    // it to a random location to maintain uniform random order
+    void placeLast();
 
-    // initialize queue; allocate memory to initial capacity
+    // initialize queue; allocate memory to initial capacity, unless the
+    // inline storage holds it
     void initQueue();
 
     // release all memory allocated to queue
     void deleteQueue();
 
-    T*  m_queue{nullptr};   // pointer to array that contains the queue
-    int m_size{0};          // number of objects currently in the queue
-    int m_capacity{0};      // number of objects allowed in the queue
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    // construct/destroy an object at the given index of the array
+    template <typename... Args>
+    void construct(T* queue, int index, Args&&... args)
+        { AllocTraits::construct(m_alloc, queue + index,
+                                 std::forward<Args>(args)...); }
+    void destroy(T* queue, int index)
+        { AllocTraits::destroy(m_alloc, queue + index); }
+
+    // obtain/release an array of the given capacity; an array of the inline
+    // capacity is the inline storage
+    T* allocateQueue(int capacity);
+    void deallocateQueue(T* queue, int capacity);
+
+    Alloc        m_alloc{};         // allocator of the array
+    GrowthPolicy m_policy{};        // how the array grows and shrinks
+    T*           m_queue{nullptr};  // pointer to array that contains the queue
+    int          m_size{0};         // number of objects currently in the queue
+    int          m_capacity{0};     // number of objects allowed in the queue
+    int          m_reserved{0};     // capacity reserved by reserve()
+
+    // storage of the first N objects; left uninitialized, as objects are
+    // constructed in place
+    [[no_unique_address]] InlineStorage<T, N> m_inline;
 
 };
 
-template <typename T>
-RandomQueue<T>::RandomQueue():
+/**
+ * Randomized queue that holds up to N objects without allocating memory; see
+ * RandomQueue.
+ */
+template <typename T, int N, typename Alloc = std::allocator<T>>
+using SmallRandomQueue = RandomQueue<T, Alloc, N>;
+
+template <typename T, typename Alloc, int N>
+RandomQueue<T, Alloc, N>::RandomQueue(const GrowthPolicy& policy,
+                                   const Alloc& alloc):
+        m_alloc{alloc},
+        m_policy{policy},
         m_queue{nullptr},
         m_size{0},
         m_capacity{0}
 {
+    assert(policy.isValid());
+
     try {
         initQueue();
 
     } catch (const std::bad_alloc& e) { throw; }
 }
 
-template <typename T>
-RandomQueue<T>::~RandomQueue() {
+template <typename T, typename Alloc, int N>
+RandomQueue<T, Alloc, N>::~RandomQueue() {
     
     deleteQueue();
 }
 
-template <typename T>
-void RandomQueue<T>::enqueue(const T& item) {
+template <typename T, typename Alloc, int N>
+template <typename... Args>
+void RandomQueue<T, Alloc, N>::emplace(Args&&... args) {
 
     if (needToGrow()) {
         try { 
@@ -255,29 +512,48 @@ void RandomQueue<T>::enqueue(const T& item) {
         } catch (const std::bad_alloc& e) { throw; }
     }
 
-    // maintain uniform randomness within queue by adding new object to random
-    // location within the queue
-    int random_index = Random::getRandomNumber(0, m_size);
-
-    m_queue[m_size] = m_queue[random_index];
-    m_queue[random_index] = item;
-    ++m_size;
+    construct(m_queue, m_size, std::forward<Args>(args)...);
+    placeLast();
 }
 
-template <typename T>
-T RandomQueue<T>::dequeue() {
+template <typename T, typename Alloc, int N>
+template <typename InputIt>
+void RandomQueue<T, Alloc, N>::enqueueRange(InputIt first, InputIt last) {
+
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
 
-    if (m_size == 0) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
 
-        std::cerr << "RandomQueue::dequeue: queue is empty" << '\n';
-        throw std::out_of_range("queue empty, no such element");
+        auto count{std::distance(first, last)};
+        assert(count <= INT_MAX - m_size);
+
+        try {
+            reserveFor(static_cast<int>(count));
+
+        } catch (const std::bad_alloc& e) { throw; }
+
+        for (; first != last; ++first) {
+            construct(m_queue, m_size, *first);
+            placeLast();
+        }
+
+    } else {
+
+        for (; first != last; ++first)
+            emplace(*first);
     }
+}
+
+template <typename T, typename Alloc, int N>
+T RandomQueue<T, Alloc, N>::dequeue() {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty("RandomQueue::dequeue", "queue");
 
     // queue maintained in uniform random order so removing object from end of
     // queue results in random object being returned
-    T item{m_queue[m_size - 1]};
-
-    m_queue[m_size - 1] = T{};
+    T item{std::move(m_queue[m_size - 1])};
+    destroy(m_queue, m_size - 1);
     --m_size;
 
     if (needToShrink()) {
@@ -290,34 +566,155 @@ T RandomQueue<T>::dequeue() {
     return item;
 }
 
-template <typename T>
-T& RandomQueue<T>::sample() {
+template <typename T, typename Alloc, int N>
+std::optional<T> RandomQueue<T, Alloc, N>::tryDequeue()
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
 
-    if (m_size == 0) {
-    
-        std::cerr << "RandomQueue::sample: queue is empty" << '\n';
-        throw std::out_of_range("queue empty, no such element");
+    if (m_size == 0)
+        return std::nullopt;
+
+    T item{std::move(m_queue[m_size - 1])};
+    destroy(m_queue, m_size - 1);
+    --m_size;
+
+    // shrinking is only an economy of memory; on failure, keep the array
+    if (needToShrink()) {
+        try {
+            shrinkQueue(false);
+
+        } catch (const std::bad_alloc&) {}
     }
 
-    return m_queue[Random::getRandomNumber(0, m_size - 1)];
+    return item;
+}
+
+template <typename T, typename Alloc, int N>
+template <typename OutputIt>
+OutputIt RandomQueue<T, Alloc, N>::dequeueN(int k, OutputIt out) {
+
+    if (k < 0 || k > m_size)
+        ContainerError::throwTooFew("RandomQueue::dequeueN", "queue", k,
+                                    m_size);
+
+    // queue maintained in uniform random order, so the last k objects are a
+    // uniformly random subset in uniformly random order
+    for (int i{0}; i < k; ++i) {
+        *out = std::move(m_queue[m_size - 1]);
+        ++out;
+        destroy(m_queue, m_size - 1);
+        --m_size;
+    }
+
+    try {
+        shrinkAfterRemoval();
+
+    } catch (const std::bad_alloc& e) { throw; }
+
+    return out;
 }
 
-template <typename T>
-const T& RandomQueue<T>::sample() const {
+template <typename T, typename Alloc, int N>
+template <typename OutputIt>
+OutputIt RandomQueue<T, Alloc, N>::sampleK(int k, OutputIt out) {
+
+    if (k < 0 || k > m_size)
+        ContainerError::throwTooFew("RandomQueue::sampleK", "queue", k, m_size);
+
+    // partial Fisher-Yates shuffle of the last k locations; the swaps are
+    // undone afterward so that sampling does not change the order of the
+    // queue, and later removals are independent of the objects sampled
+    std::vector<int> swapped(static_cast<std::size_t>(k));
+
+    using std::swap;
+    for (int i{0}; i < k; ++i) {
+        int last{m_size - 1 - i};
+        int random_index{Random::getRandomNumber(0, last)};
+        swapped[static_cast<std::size_t>(i)] = random_index;
+        if (random_index != last)
+            swap(m_queue[last], m_queue[random_index]);
+    }
 
-    if (m_size == 0) {
-    
-        std::cerr << "RandomQueue::sample: queue is empty" << '\n';
-        throw std::out_of_range("queue empty, no such element");
+    auto restore{[this, &swapped, k]() {
+        for (int i{k - 1}; i >= 0; --i) {
+            int last{m_size - 1 - i};
+            int random_index{swapped[static_cast<std::size_t>(i)]};
+            if (random_index != last)
+                swap(m_queue[last], m_queue[random_index]);
+        }
+    }};
+
+    try {
+
+        for (int i{0}; i < k; ++i) {
+            *out = m_queue[m_size - 1 - i];
+            ++out;
+        }
+
+    } catch (...) {
+
+        restore();
+        throw;
     }
 
+    restore();
+    return out;
+}
+
+template <typename T, typename Alloc, int N>
+T& RandomQueue<T, Alloc, N>::sample() {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty("RandomQueue::sample", "queue");
+
+    return m_queue[Random::getRandomNumber(0, m_size - 1)];
+}
+
+template <typename T, typename Alloc, int N>
+const T& RandomQueue<T, Alloc, N>::sample() const {
+
+    if (m_size == 0)
+        ContainerError::throwEmpty("RandomQueue::sample", "queue");
+
     return m_queue[Random::getRandomNumber(0, m_size - 1)];
 }
 
-template <typename T>
-void RandomQueue<T>::clear() {
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::reserve(int capacity) {
+
+    assert(capacity >= 0);
+
+    m_reserved = capacity;
+    if (capacity <= m_capacity)
+        return;
+
+    try {
+
+        resizeQueue(capacity);
+
+    } catch (const std::bad_alloc& e) { throw; }
+}
+
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::shrinkToFit() {
+
+    m_reserved = 0;
+
+    int new_capacity{std::max(m_size, s_initial_capacity)};
+    if (new_capacity == m_capacity)
+        return;
+
+    try {
+
+        resizeQueue(new_capacity);
+
+    } catch (const std::bad_alloc& e) { throw; }
+}
+
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::clear() {
 
     deleteQueue();
+    m_reserved = 0;
 
     try {
         initQueue();
@@ -325,14 +722,14 @@ void RandomQueue<T>::clear() {
     } catch (const std::bad_alloc& e) { throw; }
 }
 
-template <typename T>
-void RandomQueue<T>::initQueue() {
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::initQueue() {
 
     assert(m_capacity == 0);
 
     try {
 
-        m_queue = new T[s_initial_capacity]{};
+        m_queue = allocateQueue(s_initial_capacity);
 
     } catch (const std::bad_alloc& e) {
 
@@ -344,60 +741,160 @@ void RandomQueue<T>::initQueue() {
     m_capacity = s_initial_capacity;
 }
 
-template <typename T>
-void RandomQueue<T>::deleteQueue() {
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::deleteQueue() {
 
-    delete[] m_queue;
+    if (m_queue == nullptr)
+        return;
+
+    for (int i{0}; i < m_size; ++i)
+        destroy(m_queue, i);
+
+    deallocateQueue(m_queue, m_capacity);
     m_queue = nullptr;
     m_size = 0;
     m_capacity = 0;
 }
 
-template <typename T>
-void RandomQueue<T>::growQueue() {
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::growQueue() {
+
+    try {
+
+        resizeQueue(m_policy.growth_factor * m_capacity);
+
+    } catch (const std::bad_alloc& e) { throw; }
+}
+
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::shrinkQueue(bool log) {
 
     try {
 
-        resizeQueue(s_resize_rate * m_capacity);
+        resizeQueue(std::max(m_capacity / m_policy.growth_factor,
+                             minCapacity()), log);
 
     } catch (const std::bad_alloc& e) { throw; }
 }
 
-template <typename T>
-void RandomQueue<T>::shrinkQueue() {
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::reserveFor(int count) {
+
+    int new_capacity{m_capacity};
+    while (new_capacity < m_size + count)
+        new_capacity *= m_policy.growth_factor;
+
+    if (new_capacity == m_capacity)
+        return;
 
     try {
 
-        resizeQueue(m_capacity / s_resize_rate);
+        resizeQueue(new_capacity);
 
     } catch (const std::bad_alloc& e) { throw; }
 }
 
-template <typename T>
-void RandomQueue<T>::resizeQueue(int new_capacity) {
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::shrinkAfterRemoval() {
+
+    if (m_policy.shrink_ratio == 0)
+        return;
+
+    int new_capacity{m_capacity};
+    while ((new_capacity > minCapacity()) &&
+           (m_size <= new_capacity / m_policy.shrink_ratio))
+        new_capacity = std::max(new_capacity / m_policy.growth_factor,
+                                minCapacity());
 
-    assert(m_size < new_capacity);
+    if (new_capacity == m_capacity)
+        return;
+
+    try {
+
+        resizeQueue(new_capacity);
+
+    } catch (const std::bad_alloc& e) { throw; }
+}
+
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::placeLast() {
+
+    // maintain uniform randomness within queue by swapping new object to
+    // random location within the queue
+    int random_index = Random::getRandomNumber(0, m_size);
+
+    if (random_index != m_size) {
+        using std::swap;
+        swap(m_queue[m_size], m_queue[random_index]);
+    }
+    ++m_size;
+}
+
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::resizeQueue(int new_capacity, bool log) {
+
+    // the queue never shrinks below the inline capacity, so the inline
+    // storage is free whenever it is the new array
+    assert(m_size <= new_capacity);
+    assert(!isInline() || new_capacity > N);
 
     T* new_queue{nullptr};
 
     try {
 
-        new_queue = new T[new_capacity]{};
+        new_queue = allocateQueue(new_capacity);
 
     } catch (const std::bad_alloc& e) {
 
-        std::cerr << "RandomQueue::resizeQueue: " << e.what() << '\n';
+        if (log)
+            std::cerr << "RandomQueue::resizeQueue: " << e.what() << '\n';
         throw;
     }
 
-    // copy old queue into newly allocated queue
-    for (int i{0}; i < m_size; ++i)
-        new_queue[i] = m_queue[i];
+    // move old queue into newly allocated queue; if a move may throw, and a
+    // copy is available, copy instead so the old queue is left intact
+    int moved{0};
+
+    try {
+
+        for (; moved < m_size; ++moved)
+            construct(new_queue, moved, std::move_if_noexcept(m_queue[moved]));
+
+    } catch (...) {
+
+        for (int i{0}; i < moved; ++i)
+            destroy(new_queue, i);
+        deallocateQueue(new_queue, new_capacity);
+        throw;
+    }
 
     // release all memory allocated to old queue
-    delete[] m_queue;
+    for (int i{0}; i < m_size; ++i)
+        destroy(m_queue, i);
+    deallocateQueue(m_queue, m_capacity);
+
     m_queue = new_queue;
     m_capacity = new_capacity;
 }
 
+template <typename T, typename Alloc, int N>
+T* RandomQueue<T, Alloc, N>::allocateQueue(int capacity) {
+
+    if (N > 0 && capacity == N)
+        return m_inline.data();
+
+    // may throw std::bad_alloc; reported by caller
+    return AllocTraits::allocate(m_alloc, static_cast<std::size_t>(capacity));
+}
+
+template <typename T, typename Alloc, int N>
+void RandomQueue<T, Alloc, N>::deallocateQueue(T* queue, int capacity) {
+
+    if (N > 0 && queue == m_inline.data())
+        return;
+
+    AllocTraits::deallocate(m_alloc, queue,
+                            static_cast<std::size_t>(capacity));
+}
+
 #endif // RANDOM_QUEUE_H
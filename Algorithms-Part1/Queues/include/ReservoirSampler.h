@@ -0,0 +1,64 @@
+/**
+ * \file    ReservoirSampler.h
+ * \author  Christine Jones
+ * \brief   Definition of class that decides which items of a stream enter a
+ *          reservoir sample, by Algorithm L.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef RESERVOIR_SAMPLER_H
+#define RESERVOIR_SAMPLER_H
+
+#include <cstdint>
+
+/**
+ * Class that implements Algorithm L of K.-H. Li, "Reservoir-Sampling
+ * Algorithms of Time Complexity O(n(1 + log(N/n)))" (1994), to sample k
+ * items uniformly at random from a stream of unknown length.
+ *
+ * The first k items fill the reservoir. Thereafter, rather than drawing a
+ * random number for every item, as in Algorithm R, the sampler draws the
+ * number of items to skip before the next item that replaces a uniformly
+ * random item of the reservoir. The skips follow the same distribution as
+ * those of Algorithm R, so the sample is the same uniformly random subset,
+ * but only O(k log(n/k)) random numbers are drawn for a stream of n items.
+ */
+class ReservoirSampler {
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * \param int Number of items in the reservoir; must be greater than zero.
+     */
+    explicit ReservoirSampler(int k);
+
+    /**
+     * Returns the number of items to skip, after the reservoir is filled or
+     * after the last item that entered it, before the next item that enters
+     * the reservoir. Draws two random numbers.
+     *
+     * \return uint64_t Number of items to skip.
+     */
+    std::uint64_t nextSkip();
+
+    /**
+     * Number of random numbers drawn thus far.
+     */
+    std::uint64_t randomDraws() const { return m_random_draws; }
+
+private:
+
+    // uniformly random number in (0, 1)
+    double random();
+
+    int           m_k{0};
+    double        m_w{0.0};     // largest key in the reservoir, transformed
+    std::uint64_t m_random_draws{0};
+
+};
+
+#endif // RESERVOIR_SAMPLER_H
@@ -0,0 +1,215 @@
+/**
+ * \file    SPSCQueue.h
+ * \author  Christine Jones
+ * \brief   Definition of class that implements a wait-free, bounded,
+ *          single-producer/single-consumer queue.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "CacheLine.h"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <memory>       // for std::allocator, std::allocator_traits
+#include <optional>
+#include <utility>      // for std::forward, std::move
+
+/**
+ * Class that implements a bounded first-in-first-out queue that is safe for
+ * use by exactly one producer thread and one consumer thread at a time, e.g.,
+ * to pass work between two stages of a pipeline.
+ *
+ * The queue is implemented as a ring buffer whose capacity is a power of two.
+ * The producer only writes the tail index and the consumer only writes the
+ * head index, so both operations are wait-free: each completes in a bounded
+ * number of steps regardless of the other thread. The head and tail indices
+ * are kept on separate cache lines so that the producer and consumer do not
+ * invalidate each other's cache line on every operation. Each thread also
+ * keeps a private copy of the other thread's index, and only reloads it
+ * when the queue appears full (producer) or empty (consumer).
+ *
+ * Adding to a full queue, or removing from an empty queue, fails rather than
+ * blocks; the caller decides whether to spin, yield, or do other work.
+ *
+ * This queue holds objects of a templated type. The templated type must be
+ * MoveConstructible.
+ */
+template <typename T>
+class SPSCQueue {
+
+public:
+
+    /**
+     * Constructor. Initializes an empty queue with at least the given
+     * capacity; the capacity is rounded up to a power of two. An exception of
+     * type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param int Minimum number of objects the queue is able to hold.
+     */
+    explicit SPSCQueue(int capacity);
+
+    /**
+     * Destructor. Destroys any objects remaining in the queue and releases
+     * all memory allocated to the queue. Neither thread may be using the
+     * queue.
+     */
+    ~SPSCQueue();
+
+    /**
+     * Adds an object to the end of the queue. Must only be called by the
+     * producer thread.
+     *
+     * \param U Object to be copied, or moved, into the queue.
+     * \return True if added; False if the queue is full.
+     */
+    template <typename U>
+    bool tryEnqueue(U&& item) { return tryEmplace(std::forward<U>(item)); }
+
+    /**
+     * Constructs an object in place at the end of the queue. Must only be
+     * called by the producer thread.
+     *
+     * \param Args Arguments forwarded to the constructor of the object.
+     * \return True if added; False if the queue is full.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    /**
+     * Removes the object at the front of the queue. Must only be called by
+     * the consumer thread.
+     *
+     * \return Object removed from queue; empty if the queue is empty.
+     */
+    std::optional<T> tryDequeue();
+
+    /**
+     * Number of objects the queue is able to hold.
+     */
+    int capacity() const { return static_cast<int>(m_mask + 1); }
+
+    /**
+     * Number of objects in the queue. Exact only if neither thread is using
+     * the queue; otherwise a snapshot that may already be out of date.
+     */
+    int sizeApprox() const;
+
+    // copying, assigning, moving a queue is not supported
+    SPSCQueue(const SPSCQueue& queue) = delete;
+    SPSCQueue& operator= (const SPSCQueue& queue) = delete;
+
+private:
+
+    using AllocTraits = std::allocator_traits<std::allocator<T>>;
+
+    // written by the consumer; read by the producer when the queue is full
+    alignas(cache_line_size) std::atomic<std::size_t> m_head{0};
+    std::size_t m_tail_cache{0};    // consumer's copy of m_tail
+
+    // written by the producer; read by the consumer when the queue is empty
+    alignas(cache_line_size) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_head_cache{0};    // producer's copy of m_head
+
+    // read-only after construction
+    alignas(cache_line_size) std::allocator<T> m_alloc{};
+    T*          m_slots{nullptr};   // ring buffer of objects
+    std::size_t m_mask{0};          // capacity - 1
+
+};
+
+template <typename T>
+SPSCQueue<T>::SPSCQueue(int capacity) {
+
+    assert(capacity > 0);
+
+    std::size_t size{2};
+    while (size < static_cast<std::size_t>(capacity))
+        size *= 2;
+
+    try {
+
+        m_slots = AllocTraits::allocate(m_alloc, size);
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "SPSCQueue::SPSCQueue: " << e.what() << '\n';
+        throw;
+    }
+
+    m_mask = size - 1;
+}
+
+template <typename T>
+SPSCQueue<T>::~SPSCQueue() {
+
+    std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+    for (std::size_t i{m_head.load(std::memory_order_relaxed)}; i != tail; ++i)
+        AllocTraits::destroy(m_alloc, m_slots + (i & m_mask));
+
+    AllocTraits::deallocate(m_alloc, m_slots, m_mask + 1);
+}
+
+template <typename T>
+template <typename... Args>
+bool SPSCQueue<T>::tryEmplace(Args&&... args) {
+
+    const std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+
+    // queue appears full; reload the consumer's progress
+    if (tail - m_head_cache > m_mask) {
+
+        m_head_cache = m_head.load(std::memory_order_acquire);
+        if (tail - m_head_cache > m_mask)
+            return false;
+    }
+
+    AllocTraits::construct(m_alloc, m_slots + (tail & m_mask),
+                           std::forward<Args>(args)...);
+
+    // publish the object to the consumer
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+std::optional<T> SPSCQueue<T>::tryDequeue() {
+
+    const std::size_t head{m_head.load(std::memory_order_relaxed)};
+
+    // queue appears empty; reload the producer's progress
+    if (head == m_tail_cache) {
+
+        m_tail_cache = m_tail.load(std::memory_order_acquire);
+        if (head == m_tail_cache)
+            return std::nullopt;
+    }
+
+    T* slot{m_slots + (head & m_mask)};
+    std::optional<T> item{std::move(*slot)};
+    AllocTraits::destroy(m_alloc, slot);
+
+    // release the slot to the producer
+    m_head.store(head + 1, std::memory_order_release);
+
+    return item;
+}
+
+template <typename T>
+int SPSCQueue<T>::sizeApprox() const {
+
+    std::size_t head{m_head.load(std::memory_order_acquire)};
+    std::size_t tail{m_tail.load(std::memory_order_acquire)};
+
+    return tail > head ? static_cast<int>(tail - head) : 0;
+}
+
+#endif // SPSC_QUEUE_H
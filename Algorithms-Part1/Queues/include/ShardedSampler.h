@@ -0,0 +1,87 @@
+/**
+ * \file    ShardedSampler.h
+ * \author  Christine Jones
+ * \brief   Definition of class that samples the words, or weighted lines,
+ *          of an input in parallel, one shard of the input per thread.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef SHARDED_SAMPLER_H
+#define SHARDED_SAMPLER_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * Class that samples k items of an input held in memory, e.g., by an
+ * InputBuffer, by splitting the input into one shard per thread. Each shard
+ * is sampled into its own WeightedReservoir on a TaskScheduler, and the
+ * reservoirs are then merged, which gives exactly the distribution of
+ * sampling the whole input with a single reservoir.
+ *
+ * Without a weight column, the items are the whitespace-separated words of
+ * the input, each of weight one, and every subset of k words is equally
+ * likely to be sampled. With a weight column, the items are the lines of the
+ * input, and the weight of a line is the number in the given column, i.e.,
+ * whitespace-separated field, numbered from one. The sample is then drawn as
+ * if lines were chosen one after another, without replacement, each with
+ * probability proportional to its weight among the lines not yet chosen.
+ * Lines with no fields are not items; lines whose weight is missing, not a
+ * number, negative or infinite are ignored, and counted. Lines of zero
+ * weight are never sampled.
+ *
+ * Items are returned as views of the input, without their line breaks.
+ */
+class ShardedSampler {
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * \param int Number of items to sample.
+     * \param int Number of threads, and of shards; must be greater than zero.
+     * \param int Column of the weight of each line, numbered from one; zero
+     *            to sample words of equal weight.
+     */
+    ShardedSampler(int k, int num_threads, int weight_column = 0);
+
+    /**
+     * Samples the given input. An exception of type std::bad_alloc is thrown
+     * in the case that memory fails to be allocated.
+     *
+     * \param string_view Input; must outlive the items returned.
+     *
+     * \return vector<string_view> Items sampled, in no particular order; k
+     *         items, or all the items of positive weight if there are fewer.
+     */
+    std::vector<std::string_view> sample(std::string_view input);
+
+    /**
+     * Number of items read, lines ignored, and random numbers drawn by the
+     * last call of sample().
+     */
+    std::uint64_t itemsRead() const { return m_items_read; }
+    std::uint64_t linesIgnored() const { return m_lines_ignored; }
+    std::uint64_t randomDraws() const { return m_random_draws; }
+
+private:
+
+    // split the input into the given number of shards, each ending at the
+    // end of a word, or of a line
+    std::vector<std::string_view> split(std::string_view input,
+                                        int num_shards) const;
+
+    int           m_k{0};
+    int           m_num_threads{1};
+    int           m_weight_column{0};
+    std::uint64_t m_items_read{0};
+    std::uint64_t m_lines_ignored{0};
+    std::uint64_t m_random_draws{0};
+
+};
+
+#endif // SHARDED_SAMPLER_H
@@ -0,0 +1,457 @@
+/**
+ * \file    StaticDeque.h
+ * \author  Christine Jones
+ * \brief   Definition of class that implements a deque data structure that
+ *          holds a small number of objects without allocating memory.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef STATIC_DEQUE_H
+#define STATIC_DEQUE_H
+
+#include "ContainerError.h"
+#include "Deque.h"
+#include "InlineStorage.h"
+#include <cassert>
+#include <compare>
+#include <cstddef>      // for std::ptrdiff_t
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <memory>       // for std::allocator, std::construct_at
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>      // for std::forward, std::move
+
+/**
+ * Class that implements a deque data structure, as Deque does, that holds up
+ * to N objects in storage within the deque itself, as a circular array, and
+ * so allocates no memory while it holds no more than N objects.
+ *
+ * Adding an object to a full inline array spills the deque: its objects are
+ * moved, in order, to a Deque of blocks obtained from the given allocator,
+ * which then holds every object until the deque is emptied. Once emptied, the
+ * deque returns to its inline array; the Deque keeps its memory, so a deque
+ * that spills repeatedly allocates memory only the first time, until it is
+ * cleared.
+ *
+ * Each deque operation is performed in constant time, as for Deque, but for
+ * the add that spills, which moves N objects. Indexing is constant time, and
+ * iterators are random access; adding or removing an object invalidates all
+ * iterators, and references to objects are invalidated when the deque spills
+ * or returns to its inline array.
+ *
+ * This deque holds objects of a templated type, which must be
+ * MoveConstructible; it must also be CopyConstructible to add objects by
+ * const reference. A deque holding objects inline is not movable, so copying,
+ * assigning, and moving a deque is not supported.
+ */
+template <typename T, int N, typename Alloc = std::allocator<T>>
+class StaticDeque {
+
+    static_assert(N > 0);
+
+public:
+
+    using allocator_type = Alloc;
+
+    // number of objects held without allocating memory
+    static constexpr int inline_capacity{N};
+
+    /**
+     * Custom random access iterator over the deque, by index.
+     */
+    template <typename U>
+    class iter {
+
+        using Owner = std::conditional_t<std::is_const_v<U>,
+                                         const StaticDeque, StaticDeque>;
+
+    public:
+
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = std::remove_cv_t<U>;
+        using pointer           = U*;
+        using reference         = U&;
+
+        iter() {}
+        iter(Owner* deque, int index): m_deque{deque}, m_index{index} {}
+
+        // an iterator converts to a const_iterator
+        template <typename V,
+                  typename = std::enable_if_t<std::is_same_v<const V, U> &&
+                                              !std::is_same_v<V, U>>>
+        iter(const iter<V>& other):
+            m_deque{other.m_deque},
+            m_index{other.m_index}
+        {}
+
+        reference operator*() const { return (*m_deque)[m_index]; }
+        pointer operator->() const  { return &(*m_deque)[m_index]; }
+        reference operator[](difference_type n) const
+            { return (*m_deque)[m_index + static_cast<int>(n)]; }
+
+        iter& operator++() { ++m_index; return *this; }
+        iter operator++(int) { iter tmp = *this; ++m_index; return tmp; }
+        iter& operator--() { --m_index; return *this; }
+        iter operator--(int) { iter tmp = *this; --m_index; return tmp; }
+
+        iter& operator+=(difference_type n)
+            { m_index += static_cast<int>(n); return *this; }
+        iter& operator-=(difference_type n)
+            { m_index -= static_cast<int>(n); return *this; }
+
+        friend iter operator+(iter it, difference_type n) { return it += n; }
+        friend iter operator+(difference_type n, iter it) { return it += n; }
+        friend iter operator-(iter it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const iter& a, const iter& b)
+            { return a.m_index - b.m_index; }
+
+        friend bool operator==(const iter& a, const iter& b)
+            { return a.m_index == b.m_index; }
+        friend std::strong_ordering operator<=>(const iter& a, const iter& b)
+            { return a.m_index <=> b.m_index; }
+
+    private:
+
+        template <typename> friend class iter;
+
+        Owner* m_deque{nullptr};    // deque iterated over
+        int    m_index{0};          // index of current object
+    };
+    typedef iter<T>       iterator;
+    typedef iter<const T> const_iterator;
+
+    /**
+     * Constructor. Initializes an empty deque. No memory is allocated until
+     * the deque spills.
+     *
+     * \param Alloc Allocator from which the blocks of a spilled deque are
+     *              obtained.
+     */
+    StaticDeque(): StaticDeque(Alloc{}) {}
+    explicit StaticDeque(const Alloc& alloc): m_spill{alloc} {}
+
+    /**
+     * Destructor. Destroys all objects, and releases all memory allocated to
+     * the deque.
+     */
+    ~StaticDeque() { clearInline(); }
+
+    /**
+     * Determine if the deque is empty.
+     *
+     * \return True if no objects in deque; False otherwise.
+     */
+    bool isEmpty() const { return size() == 0; }
+
+    /**
+     * Returns the number of objects contained in the deque.
+     *
+     * \return Number of objects in deque.
+     */
+    int size() const { return m_spilled ? m_spill.size() : m_size; }
+
+    /**
+     * Determine if the objects of the deque are held in its inline array,
+     * rather than in allocated blocks.
+     */
+    bool isInline() const { return !m_spilled; }
+
+    /**
+     * Methods to add object to beginning/end of deque. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     *
+     * \param T Object to be copied, or moved, into the deque.
+     */
+    void addFirst(const T& item) { emplaceFirst(item); }
+    void addFirst(T&& item)      { emplaceFirst(std::move(item)); }
+    void addLast(const T& item)  { emplaceLast(item); }
+    void addLast(T&& item)       { emplaceLast(std::move(item)); }
+
+    /**
+     * Methods to construct object in place at beginning/end of deque. An
+     * exception of type std::bad_alloc is thrown in the case that memory fails
+     * to be allocated.
+     *
+     * \param Args Arguments forwarded to the constructor of the object.
+     * \return Reference to the newly constructed object.
+     */
+    template <typename... Args>
+    T& emplaceFirst(Args&&... args);
+    template <typename... Args>
+    T& emplaceLast(Args&&... args);
+
+    /**
+     * Methods to remove object from beginning/end of deque. An exception of
+     * type std::out_of_range is thrown in the case that the deque is empty.
+     *
+     * \return Object removed from deque.
+     */
+    T removeFirst();
+    T removeLast();
+
+    /**
+     * Methods that return the object at the beginning/end of deque, without
+     * removing it. An exception of type std::out_of_range is thrown in the
+     * case that the deque is empty.
+     *
+     * \return Reference to the object.
+     */
+    T& peekFirst()
+        { checkNotEmpty("StaticDeque::peekFirst"); return (*this)[0]; }
+    const T& peekFirst() const
+        { checkNotEmpty("StaticDeque::peekFirst"); return (*this)[0]; }
+    T& peekLast()
+        { checkNotEmpty("StaticDeque::peekLast"); return (*this)[size() - 1]; }
+    const T& peekLast() const
+        { checkNotEmpty("StaticDeque::peekLast"); return (*this)[size() - 1]; }
+
+    /**
+     * Methods that return the object at the given index, counted from the
+     * beginning of the deque, in constant time. The index must be in
+     * [0, size) for operator[]; at() throws an exception of type
+     * std::out_of_range in the case that it is not.
+     *
+     * \param int Index of the object.
+     *
+     * \return Reference to the object.
+     */
+    T& operator[](int index) {
+        assert(index >= 0 && index < size());
+        return m_spilled ? m_spill[index] : *slot(index);
+    }
+    const T& operator[](int index) const {
+        assert(index >= 0 && index < size());
+        return m_spilled ? m_spill[index] : *slot(index);
+    }
+    T& at(int index)             { checkIndex(index); return (*this)[index]; }
+    const T& at(int index) const { checkIndex(index); return (*this)[index]; }
+
+    /**
+     * Clears all objects from the deque, releasing allocated memory.
+     * Reinitializes to an empty deque, held inline.
+     */
+    void clear() { clearInline(); m_spill.clear(); }
+
+    // random access iterators over the deque
+    iterator begin() { return iterator{this, 0}; }
+    iterator end()   { return iterator{this, size()}; }
+
+    const_iterator begin() const  { return const_iterator{this, 0}; }
+    const_iterator cbegin() const { return const_iterator{this, 0}; }
+    const_iterator end() const    { return const_iterator{this, size()}; }
+    const_iterator cend() const   { return const_iterator{this, size()}; }
+
+    // copying, assigning, moving a deque is not supported
+    StaticDeque(const StaticDeque& deque) = delete;
+    StaticDeque& operator= (const StaticDeque& deque) = delete;
+
+private:
+
+    // the inline object at the given index, from the first object; the
+    // circular array wraps around its end
+    T* slot(int index) {
+        int i{m_first + index};
+        return m_inline.data() + (i < N ? i : i - N);
+    }
+    const T* slot(int index) const {
+        int i{m_first + index};
+        return m_inline.data() + (i < N ? i : i - N);
+    }
+
+    // move the inline objects, in order, to the spill deque
+    void spill();
+
+    // undo a spill that failed after the given number of objects, leaving
+    // the inline objects intact and the spill deque empty
+    void rollbackSpill(int moved);
+
+    // return to the inline array once the spill deque is emptied
+    void unspill() {
+        if (m_spill.isEmpty()) {
+            m_spilled = false;
+            m_first = 0;
+        }
+    }
+
+    // destroy the inline objects, if any, and return to the inline array;
+    // the spill deque keeps its objects and memory
+    void clearInline();
+
+    void checkNotEmpty(const char* method) const;
+    void checkIndex(int index) const;
+
+    // storage of up to N objects; left uninitialized, as objects are
+    // constructed in place
+    InlineStorage<T, N> m_inline;
+    int                 m_first{0};         // index of first inline object
+    int                 m_size{0};          // number of inline objects
+    bool                m_spilled{false};   // objects held by spill deque
+    Deque<T, Alloc>     m_spill;            // objects beyond N
+};
+
+template <typename T, int N, typename Alloc>
+template <typename... Args>
+T& StaticDeque<T, N, Alloc>::emplaceFirst(Args&&... args) {
+
+    if (!m_spilled && m_size < N) {
+
+        int first{m_first == 0 ? N - 1 : m_first - 1};
+        T* item{std::construct_at(m_inline.data() + first,
+                                  std::forward<Args>(args)...)};
+        m_first = first;
+        ++m_size;
+        return *item;
+    }
+
+    if (m_spilled)
+        return m_spill.emplaceFirst(std::forward<Args>(args)...);
+
+    // the arguments may refer to an inline object, which spilling destroys
+    T item(std::forward<Args>(args)...);
+    spill();
+    return m_spill.emplaceFirst(std::move(item));
+}
+
+template <typename T, int N, typename Alloc>
+template <typename... Args>
+T& StaticDeque<T, N, Alloc>::emplaceLast(Args&&... args) {
+
+    if (!m_spilled && m_size < N) {
+
+        T* item{std::construct_at(slot(m_size), std::forward<Args>(args)...)};
+        ++m_size;
+        return *item;
+    }
+
+    if (m_spilled)
+        return m_spill.emplaceLast(std::forward<Args>(args)...);
+
+    // the arguments may refer to an inline object, which spilling destroys
+    T item(std::forward<Args>(args)...);
+    spill();
+    return m_spill.emplaceLast(std::move(item));
+}
+
+template <typename T, int N, typename Alloc>
+T StaticDeque<T, N, Alloc>::removeFirst() {
+
+    checkNotEmpty("StaticDeque::removeFirst");
+
+    if (m_spilled) {
+
+        T item{m_spill.removeFirst()};
+        unspill();
+        return item;
+    }
+
+    T* first{slot(0)};
+    T item{std::move_if_noexcept(*first)};
+    std::destroy_at(first);
+    m_first = (m_first + 1 == N) ? 0 : m_first + 1;
+    --m_size;
+
+    return item;
+}
+
+template <typename T, int N, typename Alloc>
+T StaticDeque<T, N, Alloc>::removeLast() {
+
+    checkNotEmpty("StaticDeque::removeLast");
+
+    if (m_spilled) {
+
+        T item{m_spill.removeLast()};
+        unspill();
+        return item;
+    }
+
+    T* last{slot(m_size - 1)};
+    T item{std::move_if_noexcept(*last)};
+    std::destroy_at(last);
+    --m_size;
+
+    return item;
+}
+
+template <typename T, int N, typename Alloc>
+void StaticDeque<T, N, Alloc>::spill() {
+
+    assert(!m_spilled && m_size == N && m_spill.isEmpty());
+
+    int moved{0};
+
+    try {
+
+        for (; moved < m_size; ++moved)
+            m_spill.addLast(std::move_if_noexcept(*slot(moved)));
+
+    } catch (const std::bad_alloc& e) {
+
+        rollbackSpill(moved);
+        std::cerr << "StaticDeque::spill: " << e.what() << '\n';
+        throw;
+
+    } catch (...) {
+
+        // e.g., a copy constructor threw
+        rollbackSpill(moved);
+        throw;
+    }
+
+    clearInline();
+    m_spilled = true;
+}
+
+template <typename T, int N, typename Alloc>
+void StaticDeque<T, N, Alloc>::rollbackSpill(int moved) {
+
+    // objects that cannot throw when moved were moved, so move them back;
+    // otherwise they were copied, and the inline objects are intact
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+
+        for (int i{0}; i < moved; ++i) {
+            std::destroy_at(slot(i));
+            std::construct_at(slot(i), m_spill.removeFirst());
+        }
+    }
+
+    // the spill deque must be empty for the next spill
+    m_spill.clear();
+}
+
+template <typename T, int N, typename Alloc>
+void StaticDeque<T, N, Alloc>::clearInline() {
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+
+        for (int i{0}; i < m_size; ++i)
+            std::destroy_at(slot(i));
+    }
+
+    m_first = 0;
+    m_size = 0;
+    m_spilled = false;
+}
+
+template <typename T, int N, typename Alloc>
+void StaticDeque<T, N, Alloc>::checkNotEmpty(const char* method) const {
+
+    if (size() == 0)
+        ContainerError::throwEmpty(method, "deque");
+}
+
+template <typename T, int N, typename Alloc>
+void StaticDeque<T, N, Alloc>::checkIndex(int index) const {
+
+    if (index < 0 || index >= size())
+        ContainerError::throwOutOfRange("StaticDeque::at", "deque", index);
+}
+
+#endif // STATIC_DEQUE_H
@@ -0,0 +1,129 @@
+/**
+ * \file    TaskScheduler.h
+ * \author  Christine Jones
+ * \brief   Definition of class that runs tasks on a pool of worker threads
+ *          that balance load by work stealing.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include "MPMCQueue.h"
+#include "Random.h"
+#include "WorkStealingDeque.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Class that runs tasks on a fixed pool of worker threads.
+ *
+ * Each worker owns a WorkStealingDeque of tasks. A task submitted by a
+ * worker, e.g., a subproblem spawned by a running task, is pushed onto that
+ * worker's own deque, and workers run their own tasks most recently
+ * submitted first, which keeps related work on the same thread. Tasks
+ * submitted from any other thread are added to a shared MPMCQueue. A worker
+ * whose deque is empty takes tasks from the shared queue, and otherwise
+ * steals the oldest task from the deque of a randomly chosen worker. Workers
+ * with nothing to do sleep until a task is submitted.
+ *
+ * A task that throws an exception is reported to std::cerr and counted as
+ * complete; the exception does not propagate.
+ */
+class TaskScheduler {
+
+public:
+
+    using Task = std::function<void()>;
+
+    /**
+     * Constructor. Starts the given number of worker threads; defaults to one
+     * per hardware thread. An exception of type std::bad_alloc is thrown in
+     * the case that memory fails to be allocated.
+     *
+     * \param int Number of worker threads.
+     */
+    explicit TaskScheduler(int num_workers = defaultWorkers());
+
+    /**
+     * Destructor. Waits for all submitted tasks to complete, then stops the
+     * worker threads.
+     */
+    ~TaskScheduler();
+
+    /**
+     * Submits a task to be run by a worker thread. May be called from any
+     * thread, including from within a running task. An exception of type
+     * std::bad_alloc is thrown in the case that memory fails to be allocated.
+     *
+     * \param Task Task to be run.
+     */
+    void submit(Task task);
+
+    /**
+     * Blocks until all submitted tasks, including tasks submitted by running
+     * tasks, have completed. Must not be called from within a task.
+     */
+    void wait();
+
+    /**
+     * Number of worker threads.
+     */
+    int numWorkers() const { return static_cast<int>(m_workers.size()); }
+
+    /**
+     * Default number of worker threads; one per hardware thread.
+     */
+    static int defaultWorkers();
+
+    // copying, assigning, moving a scheduler is not supported
+    TaskScheduler(const TaskScheduler& scheduler) = delete;
+    TaskScheduler& operator= (const TaskScheduler& scheduler) = delete;
+
+private:
+
+    // capacity of the queue of tasks submitted from outside the workers
+    static constexpr int s_injection_capacity{4'096};
+
+    // state owned by each worker thread
+    struct Worker {
+        WorkStealingDeque<Task*> tasks{};
+        Random::Xoshiro256       gen{};
+        std::thread              thread{};
+    };
+
+    // body of each worker thread
+    void run(int index);
+
+    // find a task for the given worker: its own deque, then the shared
+    // queue, then another worker's deque
+    Task* findTask(int index);
+
+    // run a task, and record its completion
+    void execute(Task* task);
+
+    // wake a sleeping worker, if any, after a task is made available
+    void notifyWorker();
+
+    std::vector<std::unique_ptr<Worker>> m_workers{};
+    MPMCQueue<Task*>                     m_injected{s_injection_capacity};
+
+    std::atomic<int>  m_queued{0};      // tasks submitted, not yet started
+    std::atomic<int>  m_unfinished{0};  // tasks submitted, not yet completed
+    std::atomic<int>  m_sleeping{0};    // workers waiting for a task
+    std::atomic<bool> m_stopping{false};
+
+    std::mutex              m_mutex{};
+    std::condition_variable m_work_cv{};  // signalled when a task is queued
+    std::condition_variable m_done_cv{};  // signalled when all tasks complete
+
+};
+
+#endif // TASK_SCHEDULER_H
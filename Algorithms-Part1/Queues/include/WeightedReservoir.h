@@ -0,0 +1,317 @@
+/**
+ * \file    WeightedReservoir.h
+ * \author  Christine Jones
+ * \brief   Definition of class that samples items of a stream with
+ *          probability proportional to their weights, by random keys.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef WEIGHTED_RESERVOIR_H
+#define WEIGHTED_RESERVOIR_H
+
+#include "Random.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <functional>   // for std::greater
+#include <iostream>
+#include <limits>
+#include <new>
+#include <utility>      // for std::move
+#include <vector>
+
+/**
+ * Class that implements weighted reservoir sampling by random keys, after
+ * Efraimidis and Spirakis, "Weighted Random Sampling with a Reservoir"
+ * (2006), to sample k items from a stream of unknown length.
+ *
+ * Each item of weight w is given the key u^(1/w), for u uniformly random in
+ * (0, 1), and the reservoir keeps the k items with the largest keys; this is
+ * Algorithm A-Res. The resulting sample is distributed as k items drawn one
+ * after another, without replacement, each with probability proportional to
+ * its weight among the items not yet drawn. If all weights are equal, every
+ * subset of k items is equally likely, as with Algorithm R.
+ *
+ * Rather than drawing a key for every item, once the reservoir is full the
+ * sampler draws the total weight of the items to pass over before the next
+ * item that enters the reservoir, and then that item's key conditioned on
+ * it exceeding the smallest key in the reservoir; this is Algorithm A-ExpJ,
+ * which draws O(k log(n/k)) random numbers for n items of similar weight.
+ *
+ * Since every item's key is independent of every other item's, the k
+ * largest keys of a stream are the k largest keys among the reservoirs of
+ * any partition of the stream into parts, e.g., shards sampled by separate
+ * threads. Hence merging reservoirs, by keeping the k largest keys of their
+ * union, gives exactly the distribution of sampling the whole stream.
+ *
+ * Keys are held as logarithms, log(u)/w, to avoid underflow for small
+ * weights. This reservoir holds items of a templated type, which must be
+ * MoveConstructible and MoveAssignable.
+ */
+template <typename T>
+class WeightedReservoir {
+
+public:
+
+    /**
+     * Constructor. Initializes an empty reservoir.
+     *
+     * \param int      Number of items to sample; must be greater than zero.
+     * \param uint64_t Seed of the reservoir's random number generator; each
+     *                 reservoir sampling part of the same stream must be
+     *                 given a different seed.
+     */
+    WeightedReservoir(int k, std::uint64_t seed);
+
+    /**
+     * Number of items in the reservoir; k once at least k items of positive
+     * weight are offered.
+     */
+    int size() const { return static_cast<int>(m_entries.size()); }
+
+    /**
+     * Determines if the reservoir holds k items.
+     */
+    bool isFull() const { return size() == m_k; }
+
+    /**
+     * Offers the next item of the stream. An exception of type std::bad_alloc
+     * is thrown in the case that memory fails to be allocated.
+     *
+     * \param T      Item offered; moved into the reservoir if it is sampled.
+     * \param double Weight of the item; must be at least zero. An item of
+     *               zero weight is never sampled.
+     */
+    void offer(T item, double weight = 1.0);
+
+    /**
+     * Number of items of unit weight that may be passed over, without being
+     * offered, before the next item that enters the reservoir; zero if the
+     * reservoir is not full. Lets a stream of unit weights be skipped ahead.
+     */
+    std::uint64_t unitSkip() const;
+
+    /**
+     * Passes over items of the given total weight without offering them;
+     * must be no more than the weight of the items reported by unitSkip().
+     *
+     * \param double Total weight of the items passed over.
+     */
+    void passOver(double weight);
+
+    /**
+     * Merges the given reservoir, which samples another part of the same
+     * stream, into this one. An exception of type std::bad_alloc is thrown in
+     * the case that memory fails to be allocated.
+     *
+     * \param WeightedReservoir Reservoir to be merged; left empty.
+     */
+    void merge(WeightedReservoir&& other);
+
+    /**
+     * Removes and returns the items in the reservoir, in no particular order.
+     */
+    std::vector<T> takeItems();
+
+    /**
+     * Number of random numbers drawn thus far, for reporting.
+     */
+    std::uint64_t randomDraws() const { return m_random_draws; }
+
+    // copying, assigning a reservoir is not supported
+    WeightedReservoir(const WeightedReservoir& reservoir) = delete;
+    WeightedReservoir& operator= (const WeightedReservoir& reservoir)
+        = delete;
+
+    WeightedReservoir(WeightedReservoir&& reservoir) = default;
+    WeightedReservoir& operator= (WeightedReservoir&& reservoir) = default;
+
+private:
+
+    struct Entry {
+        double key{0.0};    // log of the item's key
+        T      item;
+
+        bool operator> (const Entry& other) const { return key > other.key; }
+    };
+
+    // uniformly random number in (0, 1)
+    double random();
+
+    // smallest key in the reservoir, which is at the top of the heap
+    double smallestKey() const { return m_entries.front().key; }
+
+    // add an entry, keeping at most k with the largest keys
+    void push(Entry entry);
+
+    // draw the weight to pass over before the next item enters
+    void drawJump();
+
+    int                m_k{0};
+    std::vector<Entry> m_entries{};     // min-heap of keys
+    Random::Xoshiro256 m_gen{};
+    double             m_jump{0.0};     // weight left to pass over
+    std::uint64_t      m_random_draws{0};
+
+};
+
+template <typename T>
+WeightedReservoir<T>::WeightedReservoir(int k, std::uint64_t seed):
+    m_k{k},
+    m_gen{seed}
+{
+    assert(k > 0);
+}
+
+template <typename T>
+void WeightedReservoir<T>::offer(T item, double weight) {
+
+    assert(weight >= 0.0);
+
+    if (weight <= 0.0)
+        return;
+
+    if (!isFull()) {
+
+        push(Entry{std::log(random()) / weight, std::move(item)});
+        if (isFull())
+            drawJump();
+        return;
+    }
+
+    m_jump -= weight;
+    if (m_jump > 0.0)
+        return;
+
+    // the item enters; its key is uniform among the keys that exceed the
+    // smallest in the reservoir, i.e., u in (t, 1) for t the smallest key
+    // raised to the power of the weight
+    double t{std::exp(weight * smallestKey())};
+    double u{t + (1.0 - t) * random()};
+    double key{std::log(u) / weight};
+
+    // rounding may leave a key equal to the smallest; keep it just above
+    key = std::max(key, std::nextafter(smallestKey(), 0.0));
+
+    push(Entry{key, std::move(item)});
+    drawJump();
+}
+
+template <typename T>
+std::uint64_t WeightedReservoir<T>::unitSkip() const {
+
+    if (!isFull())
+        return 0;
+
+    constexpr double max_skip{
+        static_cast<double>(std::numeric_limits<std::uint64_t>::max() / 2)};
+
+    // the item that reaches the jump enters, so all items before it pass
+    double skip{std::ceil(m_jump) - 1.0};
+    if (!(skip < max_skip))
+        return std::numeric_limits<std::uint64_t>::max() / 2;
+
+    return skip > 0.0 ? static_cast<std::uint64_t>(skip) : 0;
+}
+
+template <typename T>
+void WeightedReservoir<T>::passOver(double weight) {
+
+    assert(isFull() && weight < m_jump);
+
+    m_jump -= weight;
+}
+
+template <typename T>
+void WeightedReservoir<T>::merge(WeightedReservoir&& other) {
+
+    try {
+
+        m_entries.reserve(m_entries.size() + other.m_entries.size());
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "WeightedReservoir::merge: " << e.what() << '\n';
+        throw;
+    }
+
+    for (Entry& entry : other.m_entries)
+        push(std::move(entry));
+    other.m_entries.clear();
+
+    m_random_draws += other.m_random_draws;
+
+    if (isFull())
+        drawJump();
+}
+
+template <typename T>
+std::vector<T> WeightedReservoir<T>::takeItems() {
+
+    std::vector<T> items{};
+
+    try {
+
+        items.reserve(m_entries.size());
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "WeightedReservoir::takeItems: " << e.what() << '\n';
+        throw;
+    }
+
+    for (Entry& entry : m_entries)
+        items.push_back(std::move(entry.item));
+    m_entries.clear();
+
+    return items;
+}
+
+template <typename T>
+double WeightedReservoir<T>::random() {
+
+    ++m_random_draws;
+    return Random::realNumber(m_gen);
+}
+
+template <typename T>
+void WeightedReservoir<T>::push(Entry entry) {
+
+    if (isFull()) {
+
+        if (!(entry.key > smallestKey()))
+            return;
+
+        std::pop_heap(m_entries.begin(), m_entries.end(),
+                      std::greater<Entry>{});
+        m_entries.back() = std::move(entry);
+
+    } else {
+
+        try {
+
+            m_entries.push_back(std::move(entry));
+
+        } catch (const std::bad_alloc& e) {
+
+            std::cerr << "WeightedReservoir::push: " << e.what() << '\n';
+            throw;
+        }
+    }
+
+    std::push_heap(m_entries.begin(), m_entries.end(), std::greater<Entry>{});
+}
+
+template <typename T>
+void WeightedReservoir<T>::drawJump() {
+
+    // the weight passed over until an item's key beats the smallest key, t,
+    // is distributed as log(u)/log(t)
+    m_jump = std::log(random()) / smallestKey();
+}
+
+#endif // WEIGHTED_RESERVOIR_H
@@ -0,0 +1,150 @@
+/**
+ * \file    Whitespace.h
+ * \author  Christine Jones
+ * \brief   Functions that find whitespace, or the end of whitespace, in a
+ *          buffer of characters.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef WHITESPACE_H
+#define WHITESPACE_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * Whitespace is classified as by std::isspace in the "C" locale: space, and
+ * the control characters '\t', '\n', '\v', '\f' and '\r'. Where SSE2 is
+ * available, i.e., on all x86-64 processors, sixteen characters are
+ * classified at a time; any remainder shorter than sixteen characters, and
+ * all characters on other processors, are classified one at a time.
+ */
+namespace Whitespace {
+
+inline bool isSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+#if defined(__SSE2__)
+
+// bit i of the result is set if character i of the sixteen at data is
+// whitespace
+inline unsigned spaceMask(const char* data) {
+
+    __m128i chars{_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))};
+
+    // '\t' through '\r' are exactly the characters c for which c - '\t',
+    // as an unsigned byte, is at most '\r' - '\t'
+    __m128i offset{_mm_sub_epi8(chars, _mm_set1_epi8('\t'))};
+    __m128i control{_mm_cmpeq_epi8(
+        _mm_min_epu8(offset, _mm_set1_epi8('\r' - '\t')), offset)};
+    __m128i space{_mm_cmpeq_epi8(chars, _mm_set1_epi8(' '))};
+
+    return static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_or_si128(control, space)));
+}
+
+#endif
+
+/**
+ * Finds the first whitespace character in data[begin, end).
+ *
+ * \return size_t Index of the character; end if there is none.
+ */
+inline std::size_t findSpace(const char* data, std::size_t begin,
+                             std::size_t end) {
+
+#if defined(__SSE2__)
+    for (; begin + 16 <= end; begin += 16) {
+        unsigned mask{spaceMask(data + begin)};
+        if (mask != 0)
+            return begin + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+#endif
+
+    while (begin < end && !isSpace(data[begin]))
+        ++begin;
+    return begin;
+}
+
+/**
+ * Finds the first character other than whitespace in data[begin, end).
+ *
+ * \return size_t Index of the character; end if there is none.
+ */
+inline std::size_t findWord(const char* data, std::size_t begin,
+                            std::size_t end) {
+
+#if defined(__SSE2__)
+    for (; begin + 16 <= end; begin += 16) {
+        unsigned mask{~spaceMask(data + begin) & 0xFFFFu};
+        if (mask != 0)
+            return begin + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+#endif
+
+    while (begin < end && isSpace(data[begin]))
+        ++begin;
+    return begin;
+}
+
+/**
+ * Skips words in data[begin, end), counting the beginning of each word; a
+ * word already in progress at begin is not counted. Sixteen characters are
+ * examined at a time without finding the end of each word, so skipping is
+ * faster than finding each word in turn.
+ *
+ * \param bool     True if the character before begin is part of a word.
+ * \param uint64_t Number of words to skip; decreased by the number skipped.
+ *
+ * \return size_t Index of the beginning of the first word not skipped; end
+ *         if there is none.
+ */
+inline std::size_t skipWords(const char* data, std::size_t begin,
+                             std::size_t end, bool in_word,
+                             std::uint64_t& count) {
+
+#if defined(__SSE2__)
+    for (; begin + 16 <= end; begin += 16) {
+
+        // a word begins where a character other than whitespace follows
+        // whitespace
+        unsigned word{~spaceMask(data + begin) & 0xFFFFu};
+        unsigned starts{word & ~((word << 1) | (in_word ? 1u : 0u))};
+        in_word = (word >> 15) != 0;
+
+        std::uint64_t found{static_cast<std::uint64_t>(
+            std::popcount(starts))};
+        if (found > count) {
+
+            // clear the beginnings of the words skipped
+            for (; count > 0; --count)
+                starts &= starts - 1;
+            return begin + static_cast<std::size_t>(std::countr_zero(starts));
+        }
+        count -= found;
+    }
+#endif
+
+    for (; begin < end; ++begin) {
+
+        bool space{isSpace(data[begin])};
+        if (!space && !in_word) {
+            if (count == 0)
+                return begin;
+            --count;
+        }
+        in_word = !space;
+    }
+
+    return end;
+}
+
+}
+
+#endif // WHITESPACE_H
@@ -0,0 +1,93 @@
+/**
+ * \file    WordReader.h
+ * \author  Christine Jones
+ * \brief   Definition of class that reads whitespace-separated words from an
+ *          input stream in large blocks.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef WORD_READER_H
+#define WORD_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string_view>
+#include <vector>
+
+/**
+ * Class that reads the words of an input stream, where a word is a maximal
+ * sequence of characters other than whitespace, as for operator>> into a
+ * std::string. Input is read in large blocks into a buffer, regardless of
+ * line breaks, and each word is returned as a view of the buffer rather than
+ * copied into a string. A word that spans two blocks is moved to the front
+ * of the buffer before the next block is read; the buffer grows if a single
+ * word does not fit.
+ */
+class WordReader {
+
+public:
+
+    static constexpr std::size_t s_default_block_bytes{1 << 20};
+
+    /**
+     * Constructor. No input is read until the first word is requested. An
+     * exception of type std::bad_alloc is thrown in the case that memory
+     * fails to be allocated.
+     *
+     * \param istream     Stream from which words are read.
+     * \param std::size_t Number of bytes read from the stream at a time.
+     */
+    explicit WordReader(std::istream& input,
+                        std::size_t block_bytes = s_default_block_bytes);
+
+    /**
+     * Reads the next word. The view remains valid only until the next call
+     * to next() or skip(). An exception of type std::bad_alloc is thrown in
+     * the case that memory fails to be allocated.
+     *
+     * \param string_view Set to the word read.
+     *
+     * \return bool True if a word was read; False at the end of the input.
+     */
+    bool next(std::string_view& word);
+
+    /**
+     * Reads and discards up to the given number of words.
+     *
+     * \param uint64_t Number of words to skip.
+     *
+     * \return uint64_t Number of words skipped; less than requested only at
+     *         the end of the input.
+     */
+    std::uint64_t skip(std::uint64_t count);
+
+    /**
+     * Number of bytes, and words, read from the stream thus far.
+     */
+    std::uint64_t bytesRead() const { return m_bytes_read; }
+    std::uint64_t wordsRead() const { return m_words_read; }
+
+    // copying, assigning a reader is not supported
+    WordReader(const WordReader& reader) = delete;
+    WordReader& operator= (const WordReader& reader) = delete;
+
+private:
+
+    // move any unconsumed input to the front of the buffer, and read the next
+    // block after it; returns false if no more input remains
+    bool refill();
+
+    std::istream&     m_input;
+    std::vector<char> m_buffer{};
+    std::size_t       m_begin{0};       // first unconsumed byte
+    std::size_t       m_end{0};         // past the last byte read
+    bool              m_at_end{false};  // stream has no more input
+    std::uint64_t     m_bytes_read{0};
+    std::uint64_t     m_words_read{0};
+
+};
+
+#endif // WORD_READER_H
@@ -0,0 +1,71 @@
+/**
+ * \file    WordScanner.h
+ * \author  Christine Jones
+ * \brief   Definition of class that splits a buffer of characters into
+ *          whitespace-separated words, in place.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef WORD_SCANNER_H
+#define WORD_SCANNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Class that returns the words of a buffer of characters held in memory,
+ * e.g., by an InputBuffer, where a word is a maximal sequence of characters
+ * other than whitespace, as for operator>> into a std::string. Each word is
+ * returned as a view of the buffer, which remains valid for as long as the
+ * buffer does; no word is copied. Unlike WordReader, which reads a stream a
+ * block at a time, the scanner requires the whole input at once.
+ */
+class WordScanner {
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * \param string_view Characters to be split into words; must outlive
+     *                    the scanner and the words returned.
+     */
+    explicit WordScanner(std::string_view text): m_text{text} {}
+
+    /**
+     * Finds the next word.
+     *
+     * \param string_view Set to the word found.
+     *
+     * \return bool True if a word was found; False at the end of the buffer.
+     */
+    bool next(std::string_view& word);
+
+    /**
+     * Finds and discards up to the given number of words.
+     *
+     * \param uint64_t Number of words to skip.
+     *
+     * \return uint64_t Number of words skipped; less than requested only at
+     *         the end of the buffer.
+     */
+    std::uint64_t skip(std::uint64_t count);
+
+    /**
+     * Number of bytes, and words, scanned thus far.
+     */
+    std::uint64_t bytesRead() const { return m_position; }
+    std::uint64_t wordsRead() const { return m_words_read; }
+
+private:
+
+    std::string_view m_text{};
+    std::size_t      m_position{0};     // first byte not yet scanned
+    std::uint64_t    m_words_read{0};
+
+};
+
+#endif // WORD_SCANNER_H
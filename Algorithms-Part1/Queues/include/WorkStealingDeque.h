@@ -0,0 +1,298 @@
+/**
+ * \file    WorkStealingDeque.h
+ * \author  Christine Jones
+ * \brief   Definition of class that implements a lock-free work-stealing
+ *          deque.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include "CacheLine.h"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Class that implements a work-stealing deque, after Chase and Lev, with the
+ * memory orderings of Le, Pop, Cohen and Zappa Nardelli, "Correct and
+ * Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *
+ * A single owner thread adds and removes objects at the back of the deque,
+ * as a stack, and any number of thief threads remove objects from the front
+ * of the deque. In terms of Deque, push() is addLast(), pop() is removeLast()
+ * and steal() is removeFirst(). The owner's operations are lock-free and
+ * only synchronize with thieves when the deque holds a single object; thieves
+ * contend with each other, and with the owner, through a compare-and-swap on
+ * the front index.
+ *
+ * The deque is implemented as a circular array that doubles in capacity
+ * when filled. A thief may still be reading from the old array when it is
+ * replaced, so replaced arrays are retained until the deque is destroyed;
+ * their total size is less than that of the current array.
+ *
+ * This deque holds objects of a templated type, which are read and written
+ * atomically. The templated type must be TriviallyCopyable, e.g., a pointer
+ * to a task or an index.
+ */
+template <typename T>
+class WorkStealingDeque {
+
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque: type must be trivially copyable");
+
+public:
+
+    /**
+     * Constructor. Initializes an empty deque with at least the given
+     * capacity; the capacity is rounded up to a power of two. An exception of
+     * type std::bad_alloc is thrown in the case that memory fails to be
+     * allocated.
+     *
+     * \param int Initial number of objects the deque is able to hold.
+     */
+    explicit WorkStealingDeque(int capacity = s_default_capacity);
+
+    /**
+     * Destructor. Releases all memory allocated to the deque. No thread may
+     * be using the deque.
+     */
+    ~WorkStealingDeque() = default;
+
+    /**
+     * Adds an object to the back of the deque. Must only be called by the
+     * owner thread. An exception of type std::bad_alloc is thrown in the case
+     * that memory fails to be allocated.
+     *
+     * \param T Object to be added to the deque.
+     */
+    void push(T item);
+
+    /**
+     * Removes the object at the back of the deque. Must only be called by the
+     * owner thread.
+     *
+     * \return Object removed from deque; empty if the deque is empty, or the
+     *         last object was stolen by a thief.
+     */
+    std::optional<T> pop();
+
+    /**
+     * Removes the object at the front of the deque. May be called by any
+     * thread.
+     *
+     * \return Object removed from deque; empty if the deque is empty, or
+     *         another thread removed the object first.
+     */
+    std::optional<T> steal();
+
+    /**
+     * Number of objects in the deque. Exact only if no thread is using the
+     * deque; otherwise a snapshot that may already be out of date.
+     */
+    int sizeApprox() const;
+
+    /**
+     * Number of objects the deque is currently able to hold.
+     */
+    int capacity() const
+        { return static_cast<int>(
+                     m_array.load(std::memory_order_relaxed)->capacity()); }
+
+    // copying, assigning, moving a deque is not supported
+    WorkStealingDeque(const WorkStealingDeque& deque) = delete;
+    WorkStealingDeque& operator= (const WorkStealingDeque& deque) = delete;
+
+private:
+
+    static constexpr int s_default_capacity{64};
+
+    using Index = std::int64_t;
+
+    /**
+     * Circular array of atomic slots, indexed by unbounded position.
+     */
+    class Array {
+    public:
+
+        explicit Array(std::size_t capacity):
+            m_mask{capacity - 1},
+            m_slots{std::make_unique<std::atomic<T>[]>(capacity)}
+        {}
+
+        std::size_t capacity() const { return m_mask + 1; }
+
+        T get(Index i) const
+            { return m_slots[static_cast<std::size_t>(i) & m_mask].load(
+                         std::memory_order_relaxed); }
+        void put(Index i, T item)
+            { m_slots[static_cast<std::size_t>(i) & m_mask].store(
+                  item, std::memory_order_relaxed); }
+
+    private:
+
+        std::size_t                     m_mask{0};
+        std::unique_ptr<std::atomic<T>[]> m_slots{};
+    };
+
+    // replace the array with one of twice the capacity, holding the objects
+    // at positions [front, back)
+    Array* growArray(Array* array, Index front, Index back);
+
+    // the front is written by thieves, the back by the owner
+    alignas(cache_line_size) std::atomic<Index> m_front{0};
+    alignas(cache_line_size) std::atomic<Index> m_back{0};
+    alignas(cache_line_size) std::atomic<Array*> m_array{nullptr};
+
+    // all arrays, current and replaced; only modified by the owner
+    std::vector<std::unique_ptr<Array>> m_arrays{};
+
+};
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(int capacity) {
+
+    assert(capacity > 0);
+
+    std::size_t size{2};
+    while (size < static_cast<std::size_t>(capacity))
+        size *= 2;
+
+    try {
+
+        m_arrays.push_back(std::make_unique<Array>(size));
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "WorkStealingDeque::WorkStealingDeque: " << e.what()
+                  << '\n';
+        throw;
+    }
+
+    m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(T item) {
+
+    Index  back{m_back.load(std::memory_order_relaxed)};
+    Index  front{m_front.load(std::memory_order_acquire)};
+    Array* array{m_array.load(std::memory_order_relaxed)};
+
+    if (back - front > static_cast<Index>(array->capacity()) - 1) {
+
+        try {
+
+            array = growArray(array, front, back);
+
+        } catch (const std::bad_alloc& e) {
+
+            std::cerr << "WorkStealingDeque::push: " << e.what() << '\n';
+            throw;
+        }
+    }
+
+    array->put(back, item);
+
+    // the object must be visible before a thief can see the new back
+    std::atomic_thread_fence(std::memory_order_release);
+    m_back.store(back + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::pop() {
+
+    Index  back{m_back.load(std::memory_order_relaxed) - 1};
+    Array* array{m_array.load(std::memory_order_relaxed)};
+
+    // reserve the last object before reading the front, so that a thief
+    // either sees the reservation or the owner sees the thief's steal
+    m_back.store(back, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Index front{m_front.load(std::memory_order_relaxed)};
+
+    if (front > back) {
+
+        // deque is empty
+        m_back.store(back + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    T item{array->get(back)};
+
+    if (front == back) {
+
+        // single object remaining; race thieves for it
+        bool won{m_front.compare_exchange_strong(
+                     front, front + 1,
+                     std::memory_order_seq_cst, std::memory_order_relaxed)};
+
+        m_back.store(back + 1, std::memory_order_relaxed);
+
+        if (!won)
+            return std::nullopt;
+    }
+
+    return item;
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::steal() {
+
+    Index front{m_front.load(std::memory_order_acquire)};
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Index back{m_back.load(std::memory_order_acquire)};
+
+    if (front >= back)
+        return std::nullopt;
+
+    Array* array{m_array.load(std::memory_order_acquire)};
+    T item{array->get(front)};
+
+    // claim the object; fails if the owner or another thief claimed it first
+    if (!m_front.compare_exchange_strong(
+            front, front + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed))
+        return std::nullopt;
+
+    return item;
+}
+
+template <typename T>
+int WorkStealingDeque<T>::sizeApprox() const {
+
+    Index front{m_front.load(std::memory_order_acquire)};
+    Index back{m_back.load(std::memory_order_acquire)};
+
+    return back > front ? static_cast<int>(back - front) : 0;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Array*
+WorkStealingDeque<T>::growArray(Array* array, Index front, Index back) {
+
+    m_arrays.reserve(m_arrays.size() + 1);
+    auto bigger{std::make_unique<Array>(2 * array->capacity())};
+
+    for (Index i{front}; i < back; ++i)
+        bigger->put(i, array->get(i));
+
+    // the old array is retained, as thieves may still be reading from it
+    m_arrays.push_back(std::move(bigger));
+    Array* current{m_arrays.back().get()};
+    m_array.store(current, std::memory_order_release);
+
+    return current;
+}
+
+#endif // WORK_STEALING_DEQUE_H
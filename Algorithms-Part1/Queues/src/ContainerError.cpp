@@ -0,0 +1,40 @@
+/**
+ * \file    ContainerError.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of reporting of errors by the containers.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "ContainerError.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace ContainerError {
+
+void throwEmpty(const char* method, const char* container) {
+
+    std::cerr << method << ": " << container << " is empty" << '\n';
+    throw std::out_of_range(std::string{container} +
+                            " empty, no such element");
+}
+
+void throwOutOfRange(const char* method, const char* container,
+                     long long index) {
+
+    std::cerr << method << ": index " << index << " out of range" << '\n';
+    throw std::out_of_range(std::string{container} + " index out of range");
+}
+
+void throwTooFew(const char* method, const char* container,
+                 long long requested, long long size) {
+
+    std::cerr << method << ": cannot take " << requested << " of " << size
+              << " objects" << '\n';
+    throw std::out_of_range(std::string{container} +
+                            " holds fewer objects than requested");
+}
+
+}
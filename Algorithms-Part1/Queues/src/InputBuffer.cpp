@@ -0,0 +1,96 @@
+/**
+ * \file    InputBuffer.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of class that holds the whole of an input in
+ *          memory.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "InputBuffer.h"
+#include <algorithm>     // for std::max
+#include <exception>
+#include <iostream>
+#include <new>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define INPUT_BUFFER_MMAP 1
+#endif
+
+InputBuffer::InputBuffer(std::istream& input, int fd) {
+
+    if (fd >= 0 && map(fd))
+        return;
+
+    read(input);
+}
+
+InputBuffer::~InputBuffer() {
+
+#if defined(INPUT_BUFFER_MMAP)
+    if (m_mapped)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+bool InputBuffer::map(int fd) {
+
+#if defined(INPUT_BUFFER_MMAP)
+    struct stat status{};
+    if (fstat(fd, &status) != 0 || !S_ISREG(status.st_mode) ||
+        status.st_size <= 0)
+        return false;
+
+    std::size_t size{static_cast<std::size_t>(status.st_size)};
+    void* data{mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    if (data == MAP_FAILED)
+        return false;
+
+    // the input is read front to back
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    m_data = static_cast<const char*>(data);
+    m_size = size;
+    m_mapped = true;
+
+    return true;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+void InputBuffer::read(std::istream& input) {
+
+    std::size_t size{0};
+
+    try {
+
+        while (true) {
+
+            // read a block at a time, doubling the buffer as it fills
+            if (m_buffer.size() - size < s_block_bytes)
+                m_buffer.resize(std::max(2 * m_buffer.size(),
+                                         size + s_block_bytes));
+
+            input.read(m_buffer.data() + size,
+                       static_cast<std::streamsize>(m_buffer.size() - size));
+            std::size_t count{static_cast<std::size_t>(input.gcount())};
+            size += count;
+
+            if (count == 0)
+                break;
+        }
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "InputBuffer::read: " << e.what() << '\n';
+        throw;
+    }
+
+    m_data = m_buffer.data();
+    m_size = size;
+}
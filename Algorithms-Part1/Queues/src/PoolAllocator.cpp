@@ -0,0 +1,102 @@
+/**
+ * \file    PoolAllocator.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of a pool of fixed-size chunks of memory.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "PoolAllocator.h"
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <new>
+
+BlockPool::BlockPool(std::size_t chunk_bytes, std::size_t chunks_per_slab):
+    m_chunk_bytes{0},
+    m_chunks_per_slab{chunks_per_slab > 0 ? chunks_per_slab : 1},
+    m_free{nullptr},
+    m_slabs{},
+    m_chunks_in_use{0},
+    m_heap_fallbacks{0}
+{
+    // every chunk must hold a free list link, and be suitably aligned for
+    // any object
+    constexpr std::size_t align{alignof(std::max_align_t)};
+
+    std::size_t bytes{chunk_bytes > sizeof(FreeChunk) ?
+                      chunk_bytes : sizeof(FreeChunk)};
+    m_chunk_bytes = ((bytes + align - 1) / align) * align;
+}
+
+BlockPool::~BlockPool() {
+
+    assert(m_chunks_in_use == 0);
+
+    for (void* slab : m_slabs)
+        ::operator delete(slab);
+}
+
+void* BlockPool::allocate(std::size_t bytes) {
+
+    if (bytes > m_chunk_bytes) {
+
+        ++m_heap_fallbacks;
+        return ::operator new(bytes);
+    }
+
+    if (m_free == nullptr) {
+
+        try {
+
+            addSlab();
+
+        } catch (const std::bad_alloc& e) {
+
+            std::cerr << "BlockPool::allocate: " << e.what() << '\n';
+            throw;
+        }
+    }
+
+    FreeChunk* chunk{m_free};
+    m_free = chunk->next;
+    ++m_chunks_in_use;
+
+    return chunk;
+}
+
+void BlockPool::deallocate(void* ptr, std::size_t bytes) noexcept {
+
+    if (ptr == nullptr)
+        return;
+
+    if (bytes > m_chunk_bytes) {
+
+        ::operator delete(ptr);
+        return;
+    }
+
+    FreeChunk* chunk{static_cast<FreeChunk*>(ptr)};
+    chunk->next = m_free;
+    m_free = chunk;
+    --m_chunks_in_use;
+}
+
+void BlockPool::addSlab() {
+
+    // reserve first, so that a failure leaves the pool unchanged
+    m_slabs.reserve(m_slabs.size() + 1);
+
+    std::byte* slab{static_cast<std::byte*>(
+        ::operator new(m_chunk_bytes * m_chunks_per_slab))};
+    m_slabs.push_back(slab);
+
+    // link the chunks of the slab, in address order, onto the free list
+    for (std::size_t i{m_chunks_per_slab}; i > 0; --i) {
+
+        FreeChunk* chunk{::new (slab + (i - 1) * m_chunk_bytes) FreeChunk{}};
+        chunk->next = m_free;
+        m_free = chunk;
+    }
+}
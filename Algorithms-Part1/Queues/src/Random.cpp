@@ -1,7 +1,7 @@
 /**
  * \file    Random.cpp
  * \author  Christine Jones 
- * \brief   
+ * \brief   Implementation of uniformly distributed random numbers.
  *
  * \copyright 2024
  * \license   GNU GENERAL PUBLIC LICENSE version 3 
@@ -9,26 +9,54 @@
 
 #include "Random.h"
 #include <cassert>
+#include <cstdint>
 #include <random>
+#include <span>
 
 namespace Random {
 
-std::random_device rd{};
-std::mt19937 genMT{rd()};
+namespace {
 
-/**
- * Returns a random number between the given min and max, inclusive, using a
- * uniform distribution.
- * 
- * \param int Minimum number.
- * \param int Maximum number; must be greater or equal to minimum number.
- * 
- * \return int Number between given min and max, inclusive.
- */
-int getRandomNumber(int min, int max) {
+// 64 bits of seed from the operating system's source of randomness
+std::uint64_t deviceSeed() {
+
+    std::random_device rd{};
+    return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+}
+
+}
+
+Xoshiro256 genXoshiro{deviceSeed()};
+
+void getRandomNumbers(int min, int max, std::span<int> numbers) {
 
     assert(min <= max);
-    return std::uniform_int_distribution{min, max}(genMT);
+
+    std::uint32_t range{static_cast<std::uint32_t>(
+                            static_cast<std::int64_t>(max) - min + 1)};
+
+    // local copy of the engine, so its state may be kept in registers
+    Xoshiro256 gen{genXoshiro};
+
+    if (range == 0) {
+
+        for (int& number : numbers)
+            number = static_cast<int>(static_cast<std::int64_t>(min) +
+                                      static_cast<std::uint32_t>(gen() >> 32));
+
+    } else {
+
+        for (int& number : numbers)
+            number = static_cast<int>(static_cast<std::int64_t>(min) +
+                                      boundedNumber(gen, range));
+    }
+
+    genXoshiro = gen;
+}
+
+void seed(std::uint64_t seed_value) {
+
+    genXoshiro.seed(seed_value);
 }
 
 } // namespace Random
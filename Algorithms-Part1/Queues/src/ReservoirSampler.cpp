@@ -0,0 +1,49 @@
+/**
+ * \file    ReservoirSampler.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of class that decides which items of a stream
+ *          enter a reservoir sample, by Algorithm L.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "ReservoirSampler.h"
+#include "Random.h"
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+ReservoirSampler::ReservoirSampler(int k):
+    m_k{k}
+{
+    assert(k > 0);
+
+    m_w = std::exp(std::log(random()) / m_k);
+}
+
+std::uint64_t ReservoirSampler::nextSkip() {
+
+    // geometric number of items before the next whose key beats the largest
+    // key in the reservoir
+    double skip{std::floor(std::log(random()) / std::log1p(-m_w))};
+
+    // that item's key replaces the largest, leaving a new largest key
+    m_w *= std::exp(std::log(random()) / m_k);
+
+    constexpr double max_skip{
+        static_cast<double>(std::numeric_limits<std::uint64_t>::max() / 2)};
+
+    // a skip past any realistic stream; also covers w rounding down to zero
+    if (!(skip < max_skip))
+        return std::numeric_limits<std::uint64_t>::max() / 2;
+
+    return static_cast<std::uint64_t>(skip);
+}
+
+double ReservoirSampler::random() {
+
+    ++m_random_draws;
+    return Random::getRandomReal();
+}
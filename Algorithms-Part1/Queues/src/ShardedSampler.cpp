@@ -0,0 +1,243 @@
+/**
+ * \file    ShardedSampler.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of class that samples the words, or weighted
+ *          lines, of an input in parallel, one shard of the input per thread.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "ShardedSampler.h"
+#include "Random.h"
+#include "TaskScheduler.h"
+#include "WeightedReservoir.h"
+#include "Whitespace.h"
+#include "WordScanner.h"
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <system_error>
+
+namespace {
+
+using Reservoir = WeightedReservoir<std::string_view>;
+
+// results of sampling one shard
+struct ShardResult {
+    Reservoir     reservoir;
+    std::uint64_t items_read{0};
+    std::uint64_t lines_ignored{0};
+
+    // exception thrown while sampling the shard, as the scheduler does not
+    // propagate exceptions from tasks
+    std::exception_ptr error{};
+};
+
+// sample the words of a shard, each of weight one, skipping ahead by the
+// number of words the reservoir would pass over
+void sampleWords(std::string_view shard, ShardResult& result) {
+
+    WordScanner scanner{shard};
+    Reservoir& reservoir{result.reservoir};
+    std::string_view word{};
+
+    while (!reservoir.isFull() && scanner.next(word))
+        reservoir.offer(word);
+
+    while (reservoir.isFull()) {
+
+        std::uint64_t skip{reservoir.unitSkip()};
+        std::uint64_t skipped{scanner.skip(skip)};
+        reservoir.passOver(static_cast<double>(skipped));
+
+        if (skipped < skip || !scanner.next(word))
+            break;
+        reservoir.offer(word);
+    }
+
+    result.items_read = scanner.wordsRead();
+}
+
+// sample the lines of a shard, each weighted by the number in the given
+// column; every line's weight is read, but only lines that enter the
+// reservoir draw random numbers
+void sampleLines(std::string_view shard, int column, ShardResult& result) {
+
+    const char* data{shard.data()};
+    std::size_t size{shard.size()};
+    std::size_t begin{0};
+
+    while (begin < size) {
+
+        const void* newline{std::memchr(data + begin, '\n', size - begin)};
+        std::size_t end{newline != nullptr ?
+                        static_cast<std::size_t>(
+                            static_cast<const char*>(newline) - data) :
+                        size};
+
+        std::string_view line{data + begin, end - begin};
+        begin = end + 1;
+
+        // a line with no fields is not an item
+        if (Whitespace::findWord(line.data(), 0, line.size()) == line.size())
+            continue;
+
+        WordScanner fields{line};
+        std::string_view field{};
+        double weight{-1.0};
+        if (fields.skip(static_cast<std::uint64_t>(column - 1)) ==
+                static_cast<std::uint64_t>(column - 1) &&
+            fields.next(field)) {
+
+            auto [end_of_number, error]{std::from_chars(
+                field.data(), field.data() + field.size(), weight)};
+            if (error != std::errc{} ||
+                end_of_number != field.data() + field.size())
+                weight = -1.0;
+        }
+
+        if (!(weight >= 0.0) || std::isinf(weight)) {
+
+            ++result.lines_ignored;
+            continue;
+        }
+
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+
+        ++result.items_read;
+        result.reservoir.offer(line, weight);
+    }
+}
+
+}
+
+ShardedSampler::ShardedSampler(int k, int num_threads, int weight_column):
+    m_k{k},
+    m_num_threads{num_threads},
+    m_weight_column{weight_column}
+{
+    assert(k >= 0);
+    assert(num_threads > 0);
+    assert(weight_column >= 0);
+}
+
+std::vector<std::string_view> ShardedSampler::sample(std::string_view input) {
+
+    m_items_read = 0;
+    m_lines_ignored = 0;
+    m_random_draws = 0;
+
+    if (m_k == 0)
+        return {};
+
+    std::vector<std::string_view> shards{split(input, m_num_threads)};
+    std::vector<ShardResult> results{};
+
+    try {
+
+        // each reservoir is seeded from the global engine, so that the
+        // shards draw distinct sequences of random numbers
+        results.reserve(shards.size());
+        for (std::size_t i{0}; i < shards.size(); ++i)
+            results.push_back(
+                ShardResult{Reservoir{m_k, Random::genXoshiro()}});
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "ShardedSampler::sample: " << e.what() << '\n';
+        throw;
+    }
+
+    {
+        TaskScheduler scheduler{m_num_threads};
+        for (std::size_t i{0}; i < shards.size(); ++i) {
+
+            std::string_view shard{shards[i]};
+            ShardResult& result{results[i]};
+            int column{m_weight_column};
+
+            scheduler.submit([shard, &result, column]() {
+                try {
+                    if (column == 0)
+                        sampleWords(shard, result);
+                    else
+                        sampleLines(shard, column, result);
+                } catch (...) {
+                    result.error = std::current_exception();
+                }
+            });
+        }
+        scheduler.wait();
+    }
+
+    for (ShardResult& result : results)
+        if (result.error)
+            std::rethrow_exception(result.error);
+
+    Reservoir& merged{results.front().reservoir};
+    for (ShardResult& result : results) {
+
+        m_items_read += result.items_read;
+        m_lines_ignored += result.lines_ignored;
+        if (&result.reservoir != &merged)
+            merged.merge(std::move(result.reservoir));
+    }
+
+    m_random_draws = merged.randomDraws();
+    return merged.takeItems();
+}
+
+std::vector<std::string_view> ShardedSampler::split(std::string_view input,
+                                                    int num_shards) const {
+
+    std::vector<std::string_view> shards{};
+
+    try {
+
+        shards.reserve(static_cast<std::size_t>(num_shards));
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "ShardedSampler::split: " << e.what() << '\n';
+        throw;
+    }
+
+    const char* data{input.data()};
+    std::size_t size{input.size()};
+    std::size_t begin{0};
+
+    for (int i{1}; i <= num_shards; ++i) {
+
+        // the shard ends at the first end of a word, or of a line, at or
+        // after an equal share of the input
+        std::size_t end{size / static_cast<std::size_t>(num_shards) *
+                        static_cast<std::size_t>(i)};
+        if (i == num_shards || end <= begin) {
+
+            end = (i == num_shards) ? size : begin;
+
+        } else if (m_weight_column == 0) {
+
+            end = Whitespace::findSpace(data, end, size);
+
+        } else {
+
+            const void* newline{std::memchr(data + end, '\n', size - end)};
+            end = newline != nullptr ?
+                  static_cast<std::size_t>(
+                      static_cast<const char*>(newline) - data) + 1 :
+                  size;
+        }
+
+        shards.push_back(input.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return shards;
+}
@@ -0,0 +1,218 @@
+/**
+ * \file    TaskScheduler.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of a pool of worker threads that balance load by
+ *          work stealing.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "TaskScheduler.h"
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <optional>
+
+namespace {
+
+// scheduler, and index of the worker, run by the current thread; null if
+// the current thread is not a worker
+thread_local TaskScheduler* tls_scheduler{nullptr};
+thread_local int            tls_worker{-1};
+
+}
+
+TaskScheduler::TaskScheduler(int num_workers) {
+
+    assert(num_workers > 0);
+
+    try {
+
+        m_workers.reserve(static_cast<std::size_t>(num_workers));
+        for (int i{0}; i < num_workers; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+            m_workers.back()->gen.seed(static_cast<std::uint64_t>(i + 1));
+        }
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "TaskScheduler::TaskScheduler: " << e.what() << '\n';
+        throw;
+    }
+
+    // start the threads only once every worker's deque exists, as any
+    // worker may steal from any other
+    for (int i{0}; i < num_workers; ++i)
+        m_workers[static_cast<std::size_t>(i)]->thread =
+            std::thread{&TaskScheduler::run, this, i};
+}
+
+TaskScheduler::~TaskScheduler() {
+
+    wait();
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stopping.store(true);
+    }
+    m_work_cv.notify_all();
+
+    for (std::unique_ptr<Worker>& worker : m_workers)
+        worker->thread.join();
+}
+
+int TaskScheduler::defaultWorkers() {
+
+    unsigned threads{std::thread::hardware_concurrency()};
+    return threads > 0 ? static_cast<int>(threads) : 1;
+}
+
+void TaskScheduler::submit(Task task) {
+
+    assert(task);
+
+    Task* pending{nullptr};
+    try {
+
+        pending = new Task{std::move(task)};
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "TaskScheduler::submit: " << e.what() << '\n';
+        throw;
+    }
+
+    m_unfinished.fetch_add(1);
+
+    if (tls_scheduler == this) {
+
+        try {
+
+            m_workers[static_cast<std::size_t>(tls_worker)]->tasks.push(
+                pending);
+
+        } catch (const std::bad_alloc& e) {
+
+            m_unfinished.fetch_sub(1);
+            delete pending;
+            std::cerr << "TaskScheduler::submit: " << e.what() << '\n';
+            throw;
+        }
+
+    } else {
+
+        // the shared queue is bounded; wait for the workers to make room
+        while (!m_injected.tryEnqueue(pending))
+            std::this_thread::yield();
+    }
+
+    m_queued.fetch_add(1);
+    notifyWorker();
+}
+
+void TaskScheduler::wait() {
+
+    assert(tls_scheduler != this);
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_done_cv.wait(lock, [this]() { return m_unfinished.load() == 0; });
+}
+
+void TaskScheduler::run(int index) {
+
+    tls_scheduler = this;
+    tls_worker = index;
+
+    while (true) {
+
+        Task* task{findTask(index)};
+        if (task != nullptr) {
+
+            execute(task);
+            continue;
+        }
+
+        // no task found; sleep until one is queued. A submitter increments
+        // the queued count before reading the sleeping count, and a worker
+        // increments the sleeping count before reading the queued count, so
+        // at least one of them sees the other and no wake up is lost.
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_sleeping.fetch_add(1);
+        m_work_cv.wait(lock, [this]() {
+            return m_stopping.load() || m_queued.load() > 0;
+        });
+        m_sleeping.fetch_sub(1);
+
+        if (m_stopping.load() && m_queued.load() == 0)
+            return;
+    }
+}
+
+TaskScheduler::Task* TaskScheduler::findTask(int index) {
+
+    Worker& self{*m_workers[static_cast<std::size_t>(index)]};
+
+    std::optional<Task*> task{self.tasks.pop()};
+
+    if (!task)
+        task = m_injected.tryDequeue();
+
+    // try each other worker once, starting from a random victim
+    int n{numWorkers()};
+    if (!task && n > 1) {
+
+        int start{static_cast<int>(
+            Random::boundedNumber(self.gen, static_cast<std::uint32_t>(n)))};
+        for (int i{0}; i < n && !task; ++i) {
+
+            int victim{(start + i) % n};
+            if (victim != index)
+                task = m_workers[static_cast<std::size_t>(victim)]
+                           ->tasks.steal();
+        }
+    }
+
+    if (!task)
+        return nullptr;
+
+    m_queued.fetch_sub(1);
+    return *task;
+}
+
+void TaskScheduler::execute(Task* task) {
+
+    try {
+
+        (*task)();
+
+    } catch (const std::exception& e) {
+
+        std::cerr << "TaskScheduler::execute: " << e.what() << '\n';
+
+    } catch (...) {
+
+        std::cerr << "TaskScheduler::execute: unknown exception" << '\n';
+    }
+
+    delete task;
+
+    if (m_unfinished.fetch_sub(1) == 1) {
+
+        // last task complete; lock so that a waiting thread cannot miss the
+        // notification between checking the count and blocking
+        { std::lock_guard<std::mutex> lock{m_mutex}; }
+        m_done_cv.notify_all();
+    }
+}
+
+void TaskScheduler::notifyWorker() {
+
+    if (m_sleeping.load() == 0)
+        return;
+
+    { std::lock_guard<std::mutex> lock{m_mutex}; }
+    m_work_cv.notify_one();
+}
@@ -0,0 +1,136 @@
+/**
+ * \file    WordReader.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of class that reads whitespace-separated words
+ *          from an input stream in large blocks.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "WordReader.h"
+#include "Whitespace.h"
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <new>
+
+WordReader::WordReader(std::istream& input, std::size_t block_bytes):
+    m_input{input}
+{
+    assert(block_bytes > 0);
+
+    try {
+
+        m_buffer.resize(block_bytes);
+
+    } catch (const std::bad_alloc& e) {
+
+        std::cerr << "WordReader::WordReader: " << e.what() << '\n';
+        throw;
+    }
+}
+
+bool WordReader::next(std::string_view& word) {
+
+    while (true) {
+
+        m_begin = Whitespace::findWord(m_buffer.data(), m_begin, m_end);
+
+        if (m_begin == m_end) {
+
+            if (!refill())
+                return false;
+            continue;
+        }
+
+        std::size_t word_end{
+            Whitespace::findSpace(m_buffer.data(), m_begin, m_end)};
+
+        // the word may continue in the next block
+        if (word_end == m_end && !m_at_end) {
+
+            refill();
+            continue;
+        }
+
+        word = std::string_view{m_buffer.data() + m_begin,
+                                word_end - m_begin};
+        m_begin = word_end;
+        ++m_words_read;
+
+        return true;
+    }
+}
+
+std::uint64_t WordReader::skip(std::uint64_t count) {
+
+    std::uint64_t remaining{count};
+    bool in_word{false};
+
+    // count the words skipped a block at a time, until the beginning of the
+    // next word is found
+    while (true) {
+
+        std::size_t start{Whitespace::skipWords(m_buffer.data(), m_begin,
+                                                m_end, in_word, remaining)};
+        if (start < m_end) {
+
+            m_begin = start;
+            break;
+        }
+
+        // a word at the end of the block may continue in the next block
+        if (m_end > m_begin)
+            in_word = !Whitespace::isSpace(m_buffer[m_end - 1]);
+        m_begin = m_end;
+
+        if (!refill())
+            break;
+    }
+
+    m_words_read += count - remaining;
+    return count - remaining;
+}
+
+bool WordReader::refill() {
+
+    if (m_at_end)
+        return false;
+
+    std::size_t remaining{m_end - m_begin};
+    if (m_begin > 0 && remaining > 0)
+        std::memmove(m_buffer.data(), m_buffer.data() + m_begin, remaining);
+    m_begin = 0;
+    m_end = remaining;
+
+    // a single word fills the buffer; make room for the rest of it
+    if (m_end == m_buffer.size()) {
+
+        try {
+
+            m_buffer.resize(2 * m_buffer.size());
+
+        } catch (const std::bad_alloc& e) {
+
+            std::cerr << "WordReader::refill: " << e.what() << '\n';
+            throw;
+        }
+    }
+
+    m_input.read(m_buffer.data() + m_end,
+                 static_cast<std::streamsize>(m_buffer.size() - m_end));
+    std::size_t count{static_cast<std::size_t>(m_input.gcount())};
+
+    m_end += count;
+    m_bytes_read += count;
+
+    if (count == 0) {
+
+        m_at_end = true;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,41 @@
+/**
+ * \file    WordScanner.cpp
+ * \author  Christine Jones
+ * \brief   Implementation of class that splits a buffer of characters into
+ *          whitespace-separated words, in place.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "WordScanner.h"
+#include "Whitespace.h"
+
+bool WordScanner::next(std::string_view& word) {
+
+    const char* data{m_text.data()};
+    std::size_t end{m_text.size()};
+
+    std::size_t begin{Whitespace::findWord(data, m_position, end)};
+    if (begin == end) {
+
+        m_position = end;
+        return false;
+    }
+
+    m_position = Whitespace::findSpace(data, begin, end);
+    word = std::string_view{data + begin, m_position - begin};
+    ++m_words_read;
+
+    return true;
+}
+
+std::uint64_t WordScanner::skip(std::uint64_t count) {
+
+    std::uint64_t remaining{count};
+    m_position = Whitespace::skipWords(m_text.data(), m_position,
+                                       m_text.size(), false, remaining);
+
+    m_words_read += count - remaining;
+    return count - remaining;
+}
@@ -7,19 +7,186 @@
  * \license   GNU GENERAL PUBLIC LICENSE version 3 
  */
 
-#include "Random.h"
+#include "InputBuffer.h"
 #include "RandomQueue.h"
+#include "ReservoirSampler.h"
+#include "ShardedSampler.h"
+#include "TaskScheduler.h"
+#include "WordReader.h"
+#include "WordScanner.h"
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>       // for fileno
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 void printUsage() {
 
-    std::cout << "Usage: <program name> <k>" << '\n';
-    std::cout << "\tk = number of strings to print to standard output,\n"
-              << "\t    where 0 <= k <= n, and n is the number of strings\n"
-              << "\t    read from standard input\n";
+    std::cout << "Usage: <program name> [-m] [-t] [-j <threads>] "
+              << "[-w <column>] <k>" << '\n';
+    std::cout << "\tk  = number of strings to print to standard output,\n"
+              << "\t     where 0 <= k <= n, and n is the number of strings\n"
+              << "\t     read from standard input\n";
+    std::cout << "\t-m = hold the whole of standard input in memory, mapped\n"
+              << "\t     if it is a file, and copy no strings\n";
+    std::cout << "\t-t = report input throughput to standard error\n";
+    std::cout << "\t-j = sample shards of the input in parallel, with the\n"
+              << "\t     given number of threads, or 0 for one per hardware\n"
+              << "\t     thread; implies -m\n";
+    std::cout << "\t-w = sample lines rather than strings, with probability\n"
+              << "\t     proportional to the weight in the given column,\n"
+              << "\t     numbered from 1; implies -m\n";
+}
+
+/**
+ * Counts of the work done to sample strings, for reporting throughput.
+ */
+struct SampleStats {
+    std::uint64_t replaced{0};
+    std::uint64_t draws{0};
+};
+
+/**
+ * Samples k strings from the given reader, a WordReader or a WordScanner,
+ * into the given RandomQueue, which holds either copies of the strings, or
+ * views of them if the views remain valid after further strings are read.
+ *
+ * \return bool False if fewer than k strings are read.
+ */
+template <typename Reader, typename Word>
+bool sampleWords(Reader& reader, int k, RandomQueue<Word>& random_words,
+                 SampleStats& stats) {
+
+    std::string_view word{};
+
+    // first k words simply add to random queue
+    while (random_words.size() < k && reader.next(word))
+        random_words.enqueue(Word{word});
+
+    if (k > random_words.size())
+        return false;
+
+    // thereafter, skip the words that would not enter the random queue, and
+    // have each word that does replace a random word of the queue
+    if (k > 0) {
+
+        ReservoirSampler sampler{k};
+        while (true) {
+
+            std::uint64_t skip{sampler.nextSkip()};
+            if (reader.skip(skip) < skip || !reader.next(word))
+                break;
+
+            random_words.sample() = Word{word};
+            ++stats.replaced;
+        }
+        stats.draws = sampler.randomDraws();
+    }
+
+    return true;
+}
+
+/**
+ * Samples k strings from the given reader, prints them to standard output,
+ * and reports throughput to standard error if requested.
+ *
+ * \return int Exit status of the program.
+ */
+template <typename Reader, typename Word>
+int printSample(Reader& reader, int k, bool report_throughput,
+                std::chrono::steady_clock::time_point start) {
+
+    RandomQueue<Word> random_words{};
+    SampleStats stats{};
+
+    if (!sampleWords(reader, k, random_words, stats)) {
+
+        std::cout << "The given value of k is invalid, must be <= than the "
+                  << "number of given words: " << k << '\n';
+        return 1;
+    }
+
+    assert(random_words.size() == k);
+
+    for (const auto& i : random_words)
+        std::cout << i << '\n';
+    std::cout.flush();
+
+    if (report_throughput) {
+
+        std::chrono::duration<double> elapsed{
+            std::chrono::steady_clock::now() - start};
+        double megabytes{static_cast<double>(reader.bytesRead()) / 1e6};
+
+        std::cerr << "read " << reader.wordsRead() << " words, "
+                  << megabytes << " MB in " << elapsed.count() << " s: "
+                  << megabytes / elapsed.count() << " MB/s" << '\n';
+        std::cerr << "replaced " << stats.replaced << " words; drew "
+                  << static_cast<std::uint64_t>(k) + stats.replaced +
+                     stats.draws
+                  << " random numbers" << '\n';
+    }
+
+    return 0;
+}
+
+/**
+ * Samples k strings, or weighted lines, of the whole of standard input with
+ * a ShardedSampler, prints them to standard output in random order, and
+ * reports throughput to standard error if requested.
+ *
+ * \return int Exit status of the program.
+ */
+int printShardedSample(int k, int num_threads, int weight_column,
+                       bool report_throughput,
+                       std::chrono::steady_clock::time_point start) {
+
+    InputBuffer input{std::cin, fileno(stdin)};
+    ShardedSampler sampler{k, num_threads, weight_column};
+    std::vector<std::string_view> sample{sampler.sample(input.view())};
+
+    if (weight_column > 0 && sampler.linesIgnored() > 0)
+        std::cerr << "ignored " << sampler.linesIgnored() << " lines without "
+                  << "a valid weight in column " << weight_column << '\n';
+
+    if (k > static_cast<int>(sample.size())) {
+
+        std::cout << "The given value of k is invalid, must be <= than the "
+                  << "number of given " << (weight_column > 0 ?
+                     "lines of positive weight: " : "words: ")
+                  << k << '\n';
+        return 1;
+    }
+
+    // the reservoirs hold no particular order; print in random order, as
+    // the other modes do
+    RandomQueue<std::string_view> random_items{};
+    random_items.enqueueRange(sample.begin(), sample.end());
+
+    for (std::string_view i : random_items)
+        std::cout << i << '\n';
+    std::cout.flush();
+
+    if (report_throughput) {
+
+        std::chrono::duration<double> elapsed{
+            std::chrono::steady_clock::now() - start};
+        double megabytes{static_cast<double>(input.size()) / 1e6};
+
+        std::cerr << "read " << sampler.itemsRead()
+                  << (weight_column > 0 ? " lines, " : " words, ")
+                  << megabytes << " MB in " << elapsed.count() << " s with "
+                  << num_threads << " threads: "
+                  << megabytes / elapsed.count() << " MB/s" << '\n';
+        std::cerr << "drew " << sampler.randomDraws() << " random numbers"
+                  << '\n';
+    }
+
+    return 0;
 }
 
 /**
@@ -32,78 +199,116 @@ void printUsage() {
  * The number of strings, n, to be input is unknown ahead of time. For an
  * extra challenge a RandomQueue of k objects, rather than n objects, is used
  * to store the random output strings.
+ *
+ * Strings are read in large blocks, across any number of lines. Once the
+ * RandomQueue holds k strings, Algorithm L chooses how many strings to skip
+ * before the next string that replaces a random string in the queue, so that
+ * random numbers are drawn for O(k log(n/k)) strings rather than for all n.
+ *
+ * Given -m, the whole of standard input is held in memory, mapped if it is a
+ * file, and the RandomQueue holds views of the strings in place; no string
+ * is copied.
+ *
+ * Given -j, the input in memory is split into shards sampled in parallel by
+ * weighted reservoirs, which are then merged; the sample is still uniformly
+ * random. Given -w, lines rather than strings are sampled, with probability
+ * proportional to the weight in the given column of each line.
  * 
- * Usage: <program name> <k>
- *      k = number of strings to print to standard output, where 0 <= k <= n,
- *          and n is the number of strings read from standard input
+ * Usage: <program name> [-m] [-t] [-j <threads>] [-w <column>] <k>
+ *      k  = number of strings to print to standard output, where 0 <= k <= n,
+ *           and n is the number of strings read from standard input
+ *      -m = hold the whole of standard input in memory, mapped if it is a
+ *           file, and copy no strings
+ *      -t = report input throughput to standard error
+ *      -j = sample shards of the input in parallel, with the given number of
+ *           threads, or 0 for one per hardware thread; implies -m
+ *      -w = sample lines rather than strings, with probability proportional
+ *           to the weight in the given column, numbered from 1; implies -m
  */
 int main(int argc, char* argv[]) {
 
-    if (argc != 2) {
+    bool in_memory{false};
+    bool report_throughput{false};
+    int  num_threads{-1};
+    int  weight_column{0};
+    int  k{-1};
 
-        printUsage();
-        return 1;        
-    }
+    for (int i{1}; i < argc; ++i) {
 
-    int k{};
-    std::stringstream ssarg1{argv[1]};
-    if (!(ssarg1 >> k)) {
+        std::string_view arg{argv[i]};
+        if (arg == "-m") {
 
-        printUsage();
-        return 1;
-    }
+            in_memory = true;
+            continue;
+        }
 
-    if (k < 0) {
+        if (arg == "-t") {
 
-        std::cout << "Given value of k is invalid, must be >= 0: "
-                  << k << '\n';
-        printUsage();
-        return 1;
-    }
+            report_throughput = true;
+            continue;
+        }
 
-    RandomQueue<std::string> random_words{};
+        if (arg == "-j" || arg == "-w") {
 
-    // number of words processed thus far
-    int num_words{0};
+            int value{-1};
+            std::stringstream option{i + 1 < argc ? argv[++i] : ""};
+            if (!(option >> value) || !option.eof() ||
+                value < (arg == "-j" ? 0 : 1)) {
 
-    // read entire line of words
-    std::string words{};
-    std::getline(std::cin, words);
+                printUsage();
+                return 1;
+            }
 
-    // handle each word individually
-    std::istringstream iss{words};
-    std::string word{};
-    while (iss >> word) {
+            if (arg == "-j")
+                num_threads = (value == 0) ? TaskScheduler::defaultWorkers()
+                                           : value;
+            else
+                weight_column = value;
+            continue;
+        }
 
-        // first k words simply add to random queue
-        if (num_words < k)
+        std::stringstream ss{argv[i]};
+        if (k != -1 || !(ss >> k) || !ss.eof()) {
 
-            random_words.enqueue(word);
-        
+            printUsage();
+            return 1;
+        }
 
-        // for all words greater than k, generate a uniformly random number
-        // between 0 and the number of words read thus far, if the number is
-        // less than k the word is added to the queue, randomly replacing
-        // another word
-        else if (Random::getRandomNumber(0, num_words) < k) {
+        if (k < 0) {
 
-            random_words.sample() = word;
+            std::cout << "Given value of k is invalid, must be >= 0: "
+                      << k << '\n';
+            printUsage();
+            return 1;
         }
-
-        ++num_words;        
     }
 
-    if (k > random_words.size()) {
+    if (k == -1) {
 
-        std::cout << "The given value of k is invalid, must be <= than the "
-                  << "number of given words: " << k << '\n';
+        printUsage();
         return 1;
     }
-    
-    assert(random_words.size() == k);
 
-    for (const auto& i : random_words)
-        std::cout << i << '\n';
+    std::ios::sync_with_stdio(false);
+    auto start{std::chrono::steady_clock::now()};
 
-    return 0;
+    if (num_threads > 0 || weight_column > 0)
+        return printShardedSample(k, num_threads > 0 ? num_threads : 1,
+                                  weight_column, report_throughput, start);
+
+    if (in_memory) {
+
+        // every view remains valid until the input is released, so the
+        // random queue holds views, and no string is copied
+        InputBuffer input{std::cin, fileno(stdin)};
+        WordScanner scanner{input.view()};
+        return printSample<WordScanner, std::string_view>(
+                   scanner, k, report_throughput, start);
+    }
+
+    // views are invalidated as each block is read, so the random queue
+    // holds copies of the strings that enter it
+    WordReader reader{std::cin};
+    return printSample<WordReader, std::string>(
+               reader, k, report_throughput, start);
 }
@@ -12,8 +12,24 @@
 
 #include <string_view>
 
+void testRandom();
 void testDeque();
+void testMonotonicDeque();
+void testStaticDeque();
+void testMinMaxHeap();
 void testRandomQueue();
+void testConcurrentRandomQueue();
+void testWordReader();
+void testReservoirSampler();
+void testWordScanner();
+void testInputBuffer();
+void testWeightedReservoir();
+void testShardedSampler();
+void testPoolAllocator();
+void testSPSCQueue();
+void testMPMCQueue();
+void testWorkStealingDeque();
+void testTaskScheduler();
 
 namespace Test {
 
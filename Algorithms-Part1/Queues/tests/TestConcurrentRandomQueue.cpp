@@ -0,0 +1,222 @@
+/**
+ * \file    TestConcurrentRandomQueue.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for ConcurrentRandomQueue class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "ConcurrentRandomQueue.h"
+#include "Test.h"
+#include <atomic>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+void testCRQBasicOperation();
+void testCRQUniformity();
+void testCRQThreads();
+
+void testConcurrentRandomQueue() {
+
+    testCRQBasicOperation();
+    testCRQUniformity();
+    testCRQThreads();
+}
+
+void testCRQBasicOperation() {
+
+    Test::reset();
+    std::cout << "***** Concurrent Random Queue Basic *****" << '\n';
+
+    ConcurrentRandomQueue<int> q{4};
+
+    Test::ASSERT(q.numShards() == 4, "CRQ: shards"); // #1
+    Test::ASSERT(q.isEmpty() && q.size() == 0, "CRQ: empty"); // #2
+    Test::ASSERT(!q.tryDequeue().has_value(), "CRQ: try dequeue empty"); // #3
+    Test::ASSERT(!q.trySample().has_value(), "CRQ: try sample empty"); // #4
+
+    bool caught{false};
+    try {
+        q.dequeue();
+    } catch (const std::out_of_range& e) {
+        caught = true;
+    }
+    Test::ASSERT(caught, "CRQ: dequeue empty throws"); // #5
+
+    caught = false;
+    try {
+        q.sample();
+    } catch (const std::out_of_range& e) {
+        caught = true;
+    }
+    Test::ASSERT(caught, "CRQ: sample empty throws"); // #6
+
+    // objects are spread across shards, so removing all of them requires
+    // stealing from shards other than the local shard
+    const int n{100};
+    for (int i{0}; i < n; ++i)
+        q.enqueue(i);
+    Test::ASSERT(q.size() == n, "CRQ: size"); // #7
+
+    int sampled{q.sample()};
+    Test::ASSERT(sampled >= 0 && sampled < n && q.size() == n,
+                 "CRQ: sample does not remove"); // #8
+
+    std::vector<int> seen(n, 0);
+    for (int i{0}; i < n; ++i)
+        ++seen[static_cast<std::size_t>(q.dequeue())];
+
+    bool once{true};
+    for (int count : seen)
+        once &= (count == 1);
+    Test::ASSERT(once, "CRQ: each object removed once"); // #9
+    Test::ASSERT(q.isEmpty(), "CRQ: empty again"); // #10
+
+    // move-only objects, and objects constructed in place
+    ConcurrentRandomQueue<std::unique_ptr<std::string>> p{2};
+    p.enqueue(std::make_unique<std::string>("first"));
+    p.emplace(new std::string{"second"});
+    std::unique_ptr<std::string> first{p.dequeue()};
+    std::unique_ptr<std::string> second{p.dequeue()};
+    Test::ASSERT(first && second && *first != *second,
+                 "CRQ: move-only objects"); // #11
+
+    Test::runReport();
+    std::cout << "******************************************" << '\n' << '\n';
+}
+
+namespace {
+
+// chi-square statistic of the given counts against a uniform distribution
+double chiSquare(const std::vector<int>& counts, int trials) {
+
+    double expected{static_cast<double>(trials) /
+                    static_cast<double>(counts.size())};
+
+    double chi2{0.0};
+    for (int count : counts) {
+        double diff{count - expected};
+        chi2 += diff * diff / expected;
+    }
+
+    return chi2;
+}
+
+}
+
+void testCRQUniformity() {
+
+    Test::reset();
+    std::cout << "***** Concurrent Random Queue Uniformity *****" << '\n';
+
+    // critical value of the chi-square distribution with 9 degrees of
+    // freedom at a significance level of 0.001; a correct queue fails each
+    // check about once in a thousand runs
+    const int    n{10};
+    const int    trials{20'000};
+    const double critical{27.88};
+
+    std::vector<int> first_removed(n, 0);
+    std::vector<int> sampled(n, 0);
+    std::vector<int> last_position(n, 0);
+
+    for (int t{0}; t < trials; ++t) {
+
+        ConcurrentRandomQueue<int> q{4};
+        for (int i{0}; i < n; ++i)
+            q.enqueue(i);
+
+        ++sampled[static_cast<std::size_t>(q.sample())];
+
+        // the first object removed comes from the local shard, and the
+        // position at which object 0 is removed depends on every removal,
+        // including those stolen from other shards
+        for (int position{0}; position < n; ++position) {
+            int item{q.dequeue()};
+            if (position == 0)
+                ++first_removed[static_cast<std::size_t>(item)];
+            if (item == 0)
+                ++last_position[static_cast<std::size_t>(position)];
+        }
+    }
+
+    double chi2_first{chiSquare(first_removed, trials)};
+    double chi2_sample{chiSquare(sampled, trials)};
+    double chi2_position{chiSquare(last_position, trials)};
+
+    std::cout << "chi-square: first removed " << chi2_first
+              << ", sampled " << chi2_sample
+              << ", position removed " << chi2_position << '\n';
+
+    Test::ASSERT(chi2_first < critical,
+                 "CRQ: first object removed uniform"); // #1
+    Test::ASSERT(chi2_sample < critical, "CRQ: object sampled uniform"); // #2
+    Test::ASSERT(chi2_position < critical,
+                 "CRQ: removal position uniform"); // #3
+
+    Test::runReport();
+    std::cout << "**********************************************" << '\n'
+              << '\n';
+}
+
+void testCRQThreads() {
+
+    Test::reset();
+    std::cout << "***** Concurrent Random Queue Threads *****" << '\n';
+
+    const int num_producers{4};
+    const int num_consumers{4};
+    const int per_producer{50'000};
+    const int n{num_producers * per_producer};
+
+    ConcurrentRandomQueue<int> q{4};
+
+    std::vector<std::atomic<int>> removed(n);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads{};
+
+    for (int p{0}; p < num_producers; ++p) {
+        threads.emplace_back([&q, p]() {
+            for (int i{0}; i < per_producer; ++i)
+                q.enqueue(p * per_producer + i);
+        });
+    }
+
+    for (int c{0}; c < num_consumers; ++c) {
+        threads.emplace_back([&]() {
+            while (consumed.load(std::memory_order_relaxed) < n) {
+
+                std::optional<int> item{q.tryDequeue()};
+                if (!item) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                q.trySample();
+                removed[static_cast<std::size_t>(*item)].fetch_add(1);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (std::thread& t : threads)
+        t.join();
+
+    bool once{true};
+    for (const std::atomic<int>& count : removed)
+        once &= (count.load() == 1);
+
+    Test::ASSERT(consumed == n, "CRQ: threads, all objects removed"); // #1
+    Test::ASSERT(once, "CRQ: threads, each object once"); // #2
+    Test::ASSERT(q.isEmpty(), "CRQ: threads, empty"); // #3
+
+    Test::runReport();
+    std::cout << "*******************************************" << '\n'
+              << '\n';
+}
@@ -9,13 +9,29 @@
 
 #include "Deque.h"
 #include "Test.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <span>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>      // for std::as_const, std::declval
+#include <vector>
 
 void testDequeBasicOperation();
 void testDequeExceptions();
 void testDequeIterators();
+void testDequeBlocks();
+void testDequeRandomAccess();
+void testDequeBulk();
+void testDequeMove();
 std::string dequeToStr(const Deque<int>& d);
 std::string dequeToStr(const Deque<std::string_view>& d);
 
@@ -24,6 +40,10 @@ void testDeque() {
     testDequeBasicOperation();
     testDequeExceptions();
     testDequeIterators();
+    testDequeBlocks();
+    testDequeRandomAccess();
+    testDequeBulk();
+    testDequeMove();
 }
 
 void testDequeBasicOperation() {
@@ -139,6 +159,9 @@ void testDequeBasicOperation() {
     std::cout << "***********************" << '\n' << '\n';
 }
 
+static_assert(noexcept(std::declval<Deque<int>&>().tryRemoveFirst()));
+static_assert(noexcept(std::declval<Deque<int>&>().tryRemoveLast()));
+
 void testDequeExceptions() {
 
     Test::reset();
@@ -206,6 +229,49 @@ void testDequeExceptions() {
     valid_message = "SHOULD catch an error: deque empty, no such element";
     Test::ASSERT((ss.str() == valid_message), "Deque: exception"); // #4
 
+    ss.str(std::string{});
+
+    try {
+
+        d.peekFirst();
+        ss << "peek first: ???";
+
+    } catch (const std::out_of_range& e) {
+
+        ss << "SHOULD catch an error: " << e.what();
+    }
+
+    Test::ASSERT((ss.str() == valid_message), "Deque: peek exception"); // #5
+
+    // peek at either end, including when the last block has just emptied
+    for (int i{0}; i < 1'000; ++i)
+        d.addLast(i);
+    d.addFirst(-1);
+    bool peeked{d.peekFirst() == -1 && d.peekLast() == 999};
+    while (d.size() > 1) {
+        d.removeLast();
+        peeked &= (d.peekLast() == d.size() - 2);
+    }
+    d.peekLast() = 300;
+    peeked &= (d.peekFirst() == 300 && d.removeFirst() == 300);
+    Test::ASSERT(peeked, "Deque: peek first, last"); // #6
+
+    // tryRemoveFirst/tryRemoveLast neither throw nor log on an empty deque
+    std::stringstream log{};
+    std::streambuf* cerr_buf{std::cerr.rdbuf(log.rdbuf())};
+    d.clear();
+    bool tried{!d.tryRemoveFirst().has_value() &&
+               !d.tryRemoveLast().has_value()};
+    for (int i{0}; i < 1'000; ++i)
+        d.addLast(i);
+    for (int i{0}; i < 500; ++i) {
+        tried &= (d.tryRemoveFirst() == i);
+        tried &= (d.tryRemoveLast() == 999 - i);
+    }
+    tried &= !d.tryRemoveFirst().has_value() && d.isEmpty();
+    std::cerr.rdbuf(cerr_buf);
+    Test::ASSERT(tried && log.str().empty(), "Deque: try remove"); // #7
+
     Test::runReport();
     std::cout << "****************************" << '\n' << '\n';
 }
@@ -309,6 +375,456 @@ void testDequeIterators() {
     std::cout << "***************************" << '\n' << '\n';
 }
 
+namespace {
+
+// counts live instances, to verify that the deque destroys every object
+struct Counted {
+
+    static inline int s_live{0};
+
+    int value{0};
+
+    explicit Counted(int v): value{v} { ++s_live; }
+    Counted(const Counted& other): value{other.value} { ++s_live; }
+    ~Counted() { --s_live; }
+};
+
+// counts copies and moves, to verify that the deque does not copy objects
+struct Tracked {
+
+    static inline int s_copies{0};
+    static inline int s_moves{0};
+
+    int value{0};
+
+    Tracked(int v, int w): value{v + w} {}
+    Tracked(const Tracked& other): value{other.value} { ++s_copies; }
+    Tracked(Tracked&& other) noexcept: value{other.value} { ++s_moves; }
+};
+
+// compare deque contents, in order, against a std::deque
+template <typename T>
+bool dequeMatches(const Deque<T>& d, const std::deque<T>& expected) {
+
+    if (d.size() != static_cast<int>(expected.size()))
+        return false;
+
+    auto e{expected.begin()};
+    for (const auto& item : d) {
+        if (item != *e)
+            return false;
+        ++e;
+    }
+
+    return true;
+}
+
+}
+
+void testDequeBlocks() {
+
+    Test::reset();
+    std::cout << "***** Deque Blocks *****" << '\n';
+
+    // enough objects to span many blocks, and to grow the block map
+    const int n{100'000};
+
+    Deque<int> d{};
+    std::deque<int> expected{};
+
+    for (int i{0}; i < n; ++i) {
+        d.addLast(i);
+        expected.push_back(i);
+    }
+    Test::ASSERT(dequeMatches(d, expected), "Deque: add last, many"); // #1
+
+    for (int i{0}; i < n; ++i) {
+        d.addFirst(-i);
+        expected.push_front(-i);
+    }
+    Test::ASSERT(dequeMatches(d, expected), "Deque: add first, many"); // #2
+
+    bool removed_in_order{true};
+    for (int i{0}; i < n; ++i) {
+
+        removed_in_order &= (d.removeFirst() == expected.front());
+        expected.pop_front();
+        removed_in_order &= (d.removeLast() == expected.back());
+        expected.pop_back();
+    }
+    Test::ASSERT(removed_in_order && d.isEmpty(),
+                 "Deque: remove both ends, many"); // #3
+
+    // random mix of operations, crossing block boundaries in both directions
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> op{0, 3};
+    bool mix_in_order{true};
+    for (int i{0}; i < 4 * n; ++i) {
+
+        int choice{expected.empty() ? op(gen) % 2 : op(gen)};
+        if (choice == 0) {
+            d.addFirst(i);
+            expected.push_front(i);
+        } else if (choice == 1) {
+            d.addLast(i);
+            expected.push_back(i);
+        } else if (choice == 2) {
+            mix_in_order &= (d.removeFirst() == expected.front());
+            expected.pop_front();
+        } else {
+            mix_in_order &= (d.removeLast() == expected.back());
+            expected.pop_back();
+        }
+    }
+    Test::ASSERT(mix_in_order, "Deque: random mix, removed in order"); // #4
+    Test::ASSERT(dequeMatches(d, expected), "Deque: random mix"); // #5
+
+    // a queue cycling through far more objects than it holds at once
+    d.clear();
+    expected.clear();
+    for (int i{0}; i < 1'000; ++i) {
+        d.addLast(i);
+        expected.push_back(i);
+    }
+    for (int i{0}; i < n; ++i) {
+        d.addLast(i);
+        expected.push_back(i);
+        d.removeFirst();
+        expected.pop_front();
+    }
+    Test::ASSERT(dequeMatches(d, expected), "Deque: steady queue"); // #6
+
+    // objects with non-trivial construction/destruction
+    Deque<std::string> s{};
+    std::deque<std::string> s_expected{};
+    for (int i{0}; i < 5'000; ++i) {
+        s.addLast(std::to_string(i) + " is a long enough string to allocate");
+        s_expected.push_back(std::to_string(i) +
+                             " is a long enough string to allocate");
+    }
+    for (int i{0}; i < 2'500; ++i) {
+        s.removeFirst();
+        s_expected.pop_front();
+    }
+    Test::ASSERT(dequeMatches(s, s_expected), "Deque: strings"); // #7
+
+    {
+        Deque<Counted> c{};
+        for (int i{0}; i < 5'000; ++i)
+            c.addFirst(Counted{i});
+        Test::ASSERT(Counted::s_live == 5'000, "Deque: live objects"); // #8
+
+        for (int i{0}; i < 1'000; ++i)
+            c.removeLast();
+        Test::ASSERT(Counted::s_live == 4'000,
+                     "Deque: removed objects destroyed"); // #9
+
+        c.clear();
+        Test::ASSERT(Counted::s_live == 0,
+                     "Deque: clear destroys objects"); // #10
+
+        for (int i{0}; i < 5'000; ++i)
+            c.addLast(Counted{i});
+    }
+    Test::ASSERT(Counted::s_live == 0,
+                 "Deque: destructor destroys objects"); // #11
+
+    Test::runReport();
+    std::cout << "************************" << '\n' << '\n';
+}
+
+// the deque satisfies the concepts of the standard ranges library
+static_assert(std::random_access_iterator<Deque<int>::iterator>);
+static_assert(std::random_access_iterator<Deque<int>::const_iterator>);
+static_assert(std::ranges::random_access_range<Deque<int>>);
+static_assert(std::ranges::random_access_range<const Deque<int>>);
+static_assert(std::ranges::sized_range<Deque<int>>);
+
+void testDequeRandomAccess() {
+
+    Test::reset();
+    std::cout << "***** Deque Random Access *****" << '\n';
+
+    // objects added at both ends, so that the first object is part way into
+    // its block, and the blocks wrap around the end of the map
+    const int n{5'000};
+
+    Deque<int> d{};
+    for (int i{0}; i < n; ++i)
+        d.addLast(i);
+    for (int i{1}; i <= n; ++i)
+        d.addFirst(-i);
+    for (int i{0}; i < n / 2; ++i)
+        d.removeFirst();
+
+    const int size{d.size()};
+    const int first{-n + n / 2};
+
+    bool indexed{true};
+    for (int i{0}; i < size; ++i)
+        indexed &= (d[i] == first + i && d.at(i) == first + i);
+    Test::ASSERT(indexed, "Deque: operator[], at"); // #1
+
+    d[3] = 42;
+    const Deque<int>& cd{d};
+    Test::ASSERT(cd[3] == 42 && cd.at(3) == 42, "Deque: index assign"); // #2
+    d[3] = first + 3;
+
+    bool caught{false};
+    try {
+        d.at(size);
+    } catch (const std::out_of_range& e) {
+        caught = true;
+    }
+    Test::ASSERT(caught, "Deque: at out of range"); // #3
+
+    caught = false;
+    try {
+        cd.at(-1);
+    } catch (const std::out_of_range& e) {
+        caught = true;
+    }
+    Test::ASSERT(caught, "Deque: at negative"); // #4
+
+    // iterator arithmetic across blocks, in both directions
+    Deque<int>::iterator begin{d.begin()};
+    Deque<int>::iterator end{d.end()};
+    Test::ASSERT(end - begin == size && begin - end == -size,
+                 "Deque: iterator difference"); // #5
+
+    bool arithmetic{true};
+    for (int step : {1, 7, 255, 256, 257, 1'000}) {
+        for (int i{0}; i + step < size; i += step) {
+            Deque<int>::iterator it{begin + i};
+            arithmetic &= (*it == first + i && it[step] == first + i + step);
+            arithmetic &= (*(it + step) == first + i + step);
+            arithmetic &= ((it + step) - step == it && it + step > it);
+        }
+    }
+    Test::ASSERT(arithmetic, "Deque: iterator arithmetic"); // #6
+
+    Deque<int>::iterator it{end};
+    int count{0};
+    bool backward{true};
+    while (it != begin) {
+        --it;
+        ++count;
+        backward &= (*it == first + size - count);
+    }
+    Test::ASSERT(backward && count == size, "Deque: iterator decrement"); // #7
+
+    // reverse iterators
+    std::vector<int> reversed(d.rbegin(), d.rend());
+    std::vector<int> forward(cd.begin(), cd.end());
+    std::reverse(forward.begin(), forward.end());
+    Test::ASSERT(reversed == forward && reversed.front() == first + size - 1,
+                 "Deque: reverse iterators"); // #8
+
+    // binary search, and other ranges algorithms
+    bool found{true};
+    for (int v{first}; v < first + size; v += 97) {
+        auto at{std::ranges::lower_bound(cd, v)};
+        found &= (at != cd.end() && *at == v && at - cd.begin() == v - first);
+    }
+    auto past{std::ranges::lower_bound(cd, first + size)};
+    Test::ASSERT(found && past == cd.end(), "Deque: lower_bound"); // #9
+
+    std::ranges::reverse(d);
+    Test::ASSERT(d[0] == first + size - 1 && d[size - 1] == first,
+                 "Deque: ranges reverse"); // #10
+    std::ranges::sort(d);
+    Test::ASSERT(std::ranges::is_sorted(d) && d[0] == first,
+                 "Deque: ranges sort"); // #11
+
+    // iterators to remaining objects remain valid after removals at either
+    // end, and compare correctly with new iterators
+    Deque<int>::const_iterator middle{cd.begin() + size / 2};
+    for (int i{0}; i < 300; ++i) {
+        d.removeFirst();
+        d.removeLast();
+    }
+    Test::ASSERT(*middle == first + size / 2 &&
+                 middle - cd.begin() == size / 2 - 300,
+                 "Deque: iterator after removals"); // #12
+
+    Deque<int> empty{};
+    Test::ASSERT(empty.begin() == empty.end() &&
+                 empty.end() - empty.begin() == 0 &&
+                 empty.rbegin() == empty.rend(),
+                 "Deque: empty iterators"); // #13
+
+    Test::runReport();
+    std::cout << "*******************************" << '\n' << '\n';
+}
+
+static_assert(std::ranges::forward_range<Deque<int>::segment_range>);
+static_assert(std::ranges::forward_range<Deque<int>::const_segment_range>);
+
+void testDequeBulk() {
+
+    Test::reset();
+    std::cout << "***** Deque Bulk *****" << '\n';
+
+    // objects added at both ends, so that the first and last blocks are
+    // partial and the blocks wrap around the end of the map
+    const int n{3'000};
+
+    Deque<int> d{};
+    for (int i{0}; i < n; ++i)
+        d.addLast(i);
+    for (int i{1}; i <= n; ++i)
+        d.addFirst(-i);
+
+    std::vector<int> expected{};
+    for (int i{-n}; i < n; ++i)
+        expected.push_back(i);
+
+    // the segments, concatenated, are the objects of the deque in order
+    std::vector<int> joined{};
+    int segments{0};
+    bool nonempty{true};
+    for (std::span<const int> segment : std::as_const(d).segments()) {
+        joined.insert(joined.end(), segment.begin(), segment.end());
+        nonempty &= !segment.empty();
+        ++segments;
+    }
+    Test::ASSERT(joined == expected && nonempty,
+                 "Deque: segments in order"); // #1
+    Test::ASSERT(segments > 2 &&
+                 segments <= 2 + d.size() / static_cast<int>(
+                     Deque<int>::block_bytes / sizeof(int)),
+                 "Deque: one segment per block"); // #2
+
+    // segments may be written through
+    for (std::span<int> segment : d.segments())
+        for (int& i : segment)
+            i *= 2;
+    Test::ASSERT(d[0] == -2 * n && d[d.size() - 1] == 2 * (n - 1),
+                 "Deque: write through segments"); // #3
+    for (std::span<int> segment : d.segments())
+        for (int& i : segment)
+            i /= 2;
+
+    // copy out with memcpy, as a consumer handing blocks to the kernel would
+    std::vector<int> copied(static_cast<std::size_t>(d.size()));
+    std::size_t offset{0};
+    for (std::span<const int> segment : std::as_const(d).segments()) {
+        std::memcpy(copied.data() + offset, segment.data(),
+                    segment.size_bytes());
+        offset += segment.size();
+    }
+    Test::ASSERT(copied == expected, "Deque: memcpy segments"); // #4
+
+    // remove across several blocks, to a pointer and to a back inserter
+    std::vector<int> removed(1'000);
+    int* end{d.removeFirstN(1'000, removed.data())};
+    bool first_n{end == removed.data() + 1'000 && d.size() == 2 * n - 1'000};
+    for (int i{0}; i < 1'000; ++i)
+        first_n &= (removed[static_cast<std::size_t>(i)] == -n + i);
+    first_n &= (d.peekFirst() == -n + 1'000);
+    Test::ASSERT(first_n, "Deque: remove first n"); // #5
+
+    d.removeFirstN(0, removed.begin());
+    Test::ASSERT(d.size() == 2 * n - 1'000, "Deque: remove first 0"); // #6
+
+    std::stringstream ss{};
+    try {
+
+        d.removeFirstN(d.size() + 1, removed.begin());
+        ss << "remove first n: ???";
+
+    } catch (const std::out_of_range& e) {
+
+        ss << "SHOULD catch an error: " << e.what();
+    }
+    Test::ASSERT(ss.str() == "SHOULD catch an error: deque holds fewer "
+                             "objects than requested" &&
+                 d.size() == 2 * n - 1'000,
+                 "Deque: remove first n, exception"); // #7
+
+    std::vector<int> drained{};
+    d.drainTo(std::back_inserter(drained));
+    Test::ASSERT(d.isEmpty() && drained == std::vector<int>(
+                     expected.begin() + 1'000, expected.end()),
+                 "Deque: drain to"); // #8
+    Test::ASSERT(std::ranges::empty(d.segments()),
+                 "Deque: empty, no segments"); // #9
+
+    // the deque remains usable, and objects that allocate are moved out
+    Deque<std::string> words{};
+    for (int i{0}; i < 500; ++i)
+        words.addLast(std::string(40, static_cast<char>('a' + i % 26)));
+    std::vector<std::string> moved{};
+    words.drainTo(std::back_inserter(moved));
+    words.addLast("again");
+    bool strings{moved.size() == 500 && moved[27] == std::string(40, 'b')};
+    strings &= (words.size() == 1 && words.peekFirst() == "again");
+    Test::ASSERT(strings, "Deque: drain strings, reuse"); // #10
+
+    Test::runReport();
+    std::cout << "**********************" << '\n' << '\n';
+}
+
+void testDequeMove() {
+
+    Test::reset();
+    std::cout << "***** Deque Move *****" << '\n';
+
+    // move-only objects
+    Deque<std::unique_ptr<int>> p{};
+    for (int i{0}; i < 1'000; ++i) {
+        p.addLast(std::make_unique<int>(i));
+        p.addFirst(std::make_unique<int>(-i));
+    }
+    Test::ASSERT(p.size() == 2'000, "Deque: move-only add"); // #1
+
+    std::unique_ptr<int> ptr{std::make_unique<int>(5'000)};
+    p.addLast(std::move(ptr));
+    Test::ASSERT(ptr == nullptr, "Deque: move-only moved in"); // #2
+
+    std::unique_ptr<int> last{p.removeLast()};
+    std::unique_ptr<int> first{p.removeFirst()};
+    Test::ASSERT(*last == 5'000 && *first == -999,
+                 "Deque: move-only remove"); // #3
+
+    p.emplaceFirst(new int{-5'000});
+    Test::ASSERT(**p.begin() == -5'000, "Deque: move-only emplace"); // #4
+
+    // objects are neither copied nor moved when emplaced
+    Tracked::s_copies = 0;
+    Tracked::s_moves = 0;
+
+    Deque<Tracked> t{};
+    for (int i{0}; i < 1'000; ++i) {
+        t.emplaceLast(i, 1);
+        t.emplaceFirst(i, 2);
+    }
+    Test::ASSERT(Tracked::s_copies == 0 && Tracked::s_moves == 0,
+                 "Deque: emplace, no copies, no moves"); // #5
+
+    Tracked& emplaced{t.emplaceLast(10, 10)};
+    Test::ASSERT(emplaced.value == 20, "Deque: emplace reference"); // #6
+
+    // objects are moved, not copied, in and out of the deque
+    Tracked item{1, 1};
+    t.addLast(std::move(item));
+    t.addFirst(Tracked{2, 2});
+    Test::ASSERT(Tracked::s_copies == 0 && Tracked::s_moves == 2,
+                 "Deque: add rvalue, moved"); // #7
+
+    Tracked removed_first{t.removeFirst()};
+    Tracked removed_last{t.removeLast()};
+    Test::ASSERT(Tracked::s_copies == 0, "Deque: remove, moved"); // #8
+    Test::ASSERT(removed_first.value == 4 && removed_last.value == 2,
+                 "Deque: remove, values"); // #9
+
+    t.addLast(removed_first);
+    Test::ASSERT(Tracked::s_copies == 1, "Deque: add lvalue, copied"); // #10
+
+    Test::runReport();
+    std::cout << "**********************" << '\n' << '\n';
+}
+
 std::string dequeToStr(const Deque<int>& d) {
 
     std::stringstream ss;
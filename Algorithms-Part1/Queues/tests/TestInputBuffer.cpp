@@ -0,0 +1,82 @@
+/**
+ * \file    TestInputBuffer.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for InputBuffer class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "InputBuffer.h"
+#include "Test.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+void testInputBuffer() {
+
+    Test::reset();
+    std::cout << "***** Input Buffer *****" << '\n';
+
+    {
+        std::istringstream input{""};
+        InputBuffer buffer{input};
+        Test::ASSERT(buffer.size() == 0 && buffer.view().empty() &&
+                     !buffer.isMapped(), "InputBuffer: empty"); // #1
+    }
+
+    // an input of several blocks is read whole
+    std::string text{};
+    for (int i{0}; text.size() < 3 * InputBuffer::s_block_bytes + 5; ++i)
+        text += std::to_string(i) + '\n';
+
+    {
+        std::istringstream input{text};
+        InputBuffer buffer{input};
+        Test::ASSERT(!buffer.isMapped() && buffer.view() == text,
+                     "InputBuffer: read several blocks"); // #2
+    }
+
+    // a regular file is mapped rather than read
+    std::string filename{"input_buffer_test.txt"};
+    {
+        std::ofstream file{filename, std::ios::binary};
+        file << text;
+    }
+
+    std::FILE* file{std::fopen(filename.c_str(), "rb")};
+    Test::ASSERT(file != nullptr, "InputBuffer: open file"); // #3
+
+    if (file != nullptr) {
+
+        std::ifstream unread{};
+        InputBuffer buffer{unread, fileno(file)};
+        Test::ASSERT(buffer.isMapped() && buffer.view() == text,
+                     "InputBuffer: map file"); // #4
+
+        std::fclose(file);
+    }
+
+    // an empty file cannot be mapped, so the stream is read instead
+    {
+        std::ofstream truncate{filename, std::ios::binary | std::ios::trunc};
+    }
+
+    file = std::fopen(filename.c_str(), "rb");
+    if (file != nullptr) {
+
+        std::istringstream input{"not mapped"};
+        InputBuffer buffer{input, fileno(file)};
+        Test::ASSERT(!buffer.isMapped() && buffer.view() == "not mapped",
+                     "InputBuffer: fall back to stream"); // #5
+
+        std::fclose(file);
+    }
+
+    std::remove(filename.c_str());
+
+    Test::runReport();
+    std::cout << "************************" << '\n' << '\n';
+}
@@ -0,0 +1,140 @@
+/**
+ * \file    TestMPMCQueue.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for MPMCQueue class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "MPMCQueue.h"
+#include "Test.h"
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+void testMPMCBasicOperation();
+void testMPMCThreads();
+
+void testMPMCQueue() {
+
+    testMPMCBasicOperation();
+    testMPMCThreads();
+}
+
+void testMPMCBasicOperation() {
+
+    Test::reset();
+    std::cout << "***** MPMC Queue Basic *****" << '\n';
+
+    MPMCQueue<int> q{5};
+
+    Test::ASSERT(q.capacity() == 8, "MPMC: capacity power of two"); // #1
+    Test::ASSERT(q.sizeApprox() == 0, "MPMC: empty"); // #2
+    Test::ASSERT(!q.tryDequeue().has_value(), "MPMC: dequeue empty"); // #3
+
+    bool added{true};
+    for (int i{0}; i < 8; ++i)
+        added &= q.tryEnqueue(i);
+    Test::ASSERT(added && q.sizeApprox() == 8, "MPMC: fill"); // #4
+    Test::ASSERT(!q.tryEnqueue(8), "MPMC: enqueue full"); // #5
+
+    bool in_order{true};
+    for (int i{0}; i < 4; ++i)
+        in_order &= (q.tryDequeue() == i);
+    Test::ASSERT(in_order && q.sizeApprox() == 4, "MPMC: dequeue half"); // #6
+
+    // wrap around the end of the ring buffer, onto the next lap
+    for (int i{8}; i < 12; ++i)
+        added &= q.tryEnqueue(i);
+    for (int i{4}; i < 12; ++i)
+        in_order &= (q.tryDequeue() == i);
+    Test::ASSERT(added && in_order, "MPMC: wrap around"); // #7
+    Test::ASSERT(!q.tryDequeue().has_value(), "MPMC: empty again"); // #8
+
+    // move-only objects; objects left in the queue are destroyed with it
+    MPMCQueue<std::unique_ptr<std::string>> p{4};
+    p.tryEnqueue(std::make_unique<std::string>("first"));
+    p.tryEmplace(new std::string{"second"});
+    p.tryEmplace(new std::string{"third"});
+
+    std::optional<std::unique_ptr<std::string>> first{p.tryDequeue()};
+    Test::ASSERT(first.has_value() && **first == "first",
+                 "MPMC: move-only dequeue"); // #9
+
+    Test::runReport();
+    std::cout << "****************************" << '\n' << '\n';
+}
+
+void testMPMCThreads() {
+
+    Test::reset();
+    std::cout << "***** MPMC Queue Threads *****" << '\n';
+
+    const int num_producers{4};
+    const int num_consumers{4};
+    const int per_producer{250'000};
+    const int n{num_producers * per_producer};
+
+    // small capacity, so producers frequently find the queue full
+    MPMCQueue<int> q{64};
+
+    std::atomic<int>       consumed{0};
+    std::atomic<long long> sum{0};
+
+    // each consumer records the last object seen from each producer, to
+    // verify that objects from a single producer are removed in order
+    std::atomic<bool> per_producer_order{true};
+
+    std::vector<std::thread> threads{};
+
+    for (int p{0}; p < num_producers; ++p) {
+        threads.emplace_back([&q, p]() {
+            for (int i{0}; i < per_producer; ++i) {
+                while (!q.tryEnqueue(p * per_producer + i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int c{0}; c < num_consumers; ++c) {
+        threads.emplace_back([&]() {
+            std::vector<int> last(num_producers, -1);
+            long long local_sum{0};
+            while (consumed.load(std::memory_order_relaxed) < n) {
+
+                std::optional<int> item{q.tryDequeue()};
+                if (!item) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                int producer{*item / per_producer};
+                if (*item <= last[static_cast<std::size_t>(producer)])
+                    per_producer_order = false;
+                last[static_cast<std::size_t>(producer)] = *item;
+
+                local_sum += *item;
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+            sum += local_sum;
+        });
+    }
+
+    for (std::thread& t : threads)
+        t.join();
+
+    long long expected_sum{static_cast<long long>(n) * (n - 1) / 2};
+
+    Test::ASSERT(consumed == n, "MPMC: threads, all objects removed"); // #1
+    Test::ASSERT(sum == expected_sum, "MPMC: threads, each object once"); // #2
+    Test::ASSERT(per_producer_order,
+                 "MPMC: threads, per producer order"); // #3
+    Test::ASSERT(q.sizeApprox() == 0, "MPMC: threads, empty"); // #4
+
+    Test::runReport();
+    std::cout << "******************************" << '\n' << '\n';
+}
@@ -14,8 +14,24 @@
 int main() {
 
     std::cout << "Running Tests..." << '\n' << '\n';
+    testRandom();
     testDeque();
+    testMonotonicDeque();
+    testStaticDeque();
+    testMinMaxHeap();
     testRandomQueue();
+    testConcurrentRandomQueue();
+    testWordReader();
+    testReservoirSampler();
+    testWordScanner();
+    testInputBuffer();
+    testWeightedReservoir();
+    testShardedSampler();
+    testPoolAllocator();
+    testSPSCQueue();
+    testMPMCQueue();
+    testWorkStealingDeque();
+    testTaskScheduler();
     std::cout << '\n' << "COMPLETE" << '\n';
 
     return 0;
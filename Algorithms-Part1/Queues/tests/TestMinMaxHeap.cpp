@@ -0,0 +1,167 @@
+/**
+ * \file    TestMinMaxHeap.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for MinMaxHeap class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "MinMaxHeap.h"
+#include "Test.h"
+#include <algorithm>
+#include <functional>   // for std::greater
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// comparison that counts its calls
+struct CountingLess {
+
+    long long* calls{nullptr};
+
+    bool operator()(int a, int b) const { ++*calls; return a < b; }
+};
+
+}
+
+void testMinMaxHeap() {
+
+    Test::reset();
+    std::cout << "***** Min-Max Heap *****" << '\n';
+
+    MinMaxHeap<int> h{};
+    Test::ASSERT(h.isEmpty() && h.size() == 0, "MinMaxHeap: new"); // #1
+
+    for (int i : {5, 3, 9, 1, 7, 4, 8, 2, 6})
+        h.add(i);
+    Test::ASSERT(h.size() == 9 && h.peekMin() == 1 && h.peekMax() == 9,
+                 "MinMaxHeap: peek min, max"); // #2
+
+    bool removed{h.removeMin() == 1 && h.removeMax() == 9 &&
+                 h.removeMin() == 2 && h.removeMax() == 8};
+    removed &= (h.size() == 5 && h.peekMin() == 3 && h.peekMax() == 7);
+    Test::ASSERT(removed, "MinMaxHeap: remove min, max"); // #3
+
+    // random additions and removals at both ends, compared with a multiset
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> value{0, 999};
+    std::uniform_int_distribution<int> op{0, 3};
+
+    MinMaxHeap<int> random_heap{};
+    std::multiset<int> reference{};
+    bool matched{true};
+    for (int i{0}; i < 50'000; ++i) {
+
+        int o{op(gen)};
+        if (o < 2 || reference.empty()) {
+
+            int v{value(gen)};
+            random_heap.add(v);
+            reference.insert(v);
+
+        } else if (o == 2) {
+
+            matched &= (random_heap.removeMin() == *reference.begin());
+            reference.erase(reference.begin());
+
+        } else {
+
+            matched &= (random_heap.removeMax() == *reference.rbegin());
+            reference.erase(std::prev(reference.end()));
+        }
+
+        matched &= (random_heap.size() == static_cast<int>(reference.size()));
+        if (!reference.empty())
+            matched &= (random_heap.peekMin() == *reference.begin() &&
+                        random_heap.peekMax() == *reference.rbegin());
+    }
+    Test::ASSERT(matched, "MinMaxHeap: random, against multiset"); // #4
+
+    // a heap built from a range gives the objects in sorted order, from
+    // either end
+    std::vector<int> values(10'000);
+    for (int& v : values)
+        v = value(gen);
+    std::vector<int> sorted{values};
+    std::sort(sorted.begin(), sorted.end());
+
+    MinMaxHeap<int> built{values.begin(), values.end()};
+    std::vector<int> ascending{};
+    while (built.size() > 5'000)
+        ascending.push_back(built.removeMin());
+    std::vector<int> descending{};
+    while (!built.isEmpty())
+        descending.push_back(built.removeMax());
+    ascending.insert(ascending.end(), descending.rbegin(), descending.rend());
+    Test::ASSERT(ascending == sorted, "MinMaxHeap: heapify, sorted"); // #5
+
+    // heapify makes a linear number of comparisons; adding one object at a
+    // time makes more
+    long long heapify_calls{0};
+    MinMaxHeap<int, CountingLess> counted{values.begin(), values.end(),
+                                          CountingLess{&heapify_calls}};
+    std::cout << "comparisons to heapify " << values.size() << " objects: "
+              << heapify_calls << '\n';
+    Test::ASSERT(heapify_calls < 4 * static_cast<long long>(values.size()) &&
+                 counted.peekMin() == sorted.front() &&
+                 counted.peekMax() == sorted.back(),
+                 "MinMaxHeap: heapify, linear"); // #6
+
+    // an input range, without a size, is built the same way
+    std::stringstream ss{"4 8 15 16 23 42"};
+    MinMaxHeap<int, std::greater<int>> reversed{
+        std::istream_iterator<int>{ss}, std::istream_iterator<int>{}};
+    Test::ASSERT(reversed.size() == 6 && reversed.peekMin() == 42 &&
+                 reversed.removeMax() == 4,
+                 "MinMaxHeap: input range, greater"); // #7
+
+    MinMaxHeap<int> empty{};
+    int caught{0};
+    for (int i{0}; i < 4; ++i) {
+        try {
+            if (i == 0)
+                empty.peekMin();
+            else if (i == 1)
+                empty.peekMax();
+            else if (i == 2)
+                empty.removeMin();
+            else
+                empty.removeMax();
+        } catch (const std::out_of_range&) {
+            ++caught;
+        }
+    }
+    Test::ASSERT(caught == 4, "MinMaxHeap: empty, exceptions"); // #8
+
+    // move-only objects; the heap orders them through a comparison
+    auto less_pointee{[](const std::unique_ptr<int>& a,
+                         const std::unique_ptr<int>& b) { return *a < *b; }};
+    MinMaxHeap<std::unique_ptr<int>, decltype(less_pointee)> pointers{
+        less_pointee};
+    for (int i{0}; i < 100; ++i)
+        pointers.emplace(new int{(i * 37) % 100});
+    bool move_only{*pointers.removeMax() == 99 && *pointers.removeMin() == 0};
+    Test::ASSERT(move_only && pointers.size() == 98,
+                 "MinMaxHeap: move-only objects"); // #9
+
+    // the heap is reusable once cleared
+    MinMaxHeap<std::string> strings{};
+    for (int i{0}; i < 1'000; ++i)
+        strings.add(std::to_string(i));
+    strings.clear();
+    strings.add("again");
+    Test::ASSERT(strings.size() == 1 && strings.peekMax() == "again",
+                 "MinMaxHeap: clear, reuse"); // #10
+
+    Test::runReport();
+    std::cout << "************************" << '\n' << '\n';
+}
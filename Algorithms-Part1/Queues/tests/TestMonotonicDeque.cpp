@@ -0,0 +1,196 @@
+/**
+ * \file    TestMonotonicDeque.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for MonotonicDeque class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "MonotonicDeque.h"
+#include "Test.h"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>   // for std::greater
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// extreme of every full window of the given width, by rescanning each window
+template <typename Compare>
+std::vector<int> rescanWindows(const std::vector<int>& items, int width,
+                               Compare compare) {
+
+    std::vector<int> extremes{};
+    for (std::size_t i{static_cast<std::size_t>(width)}; i <= items.size();
+         ++i)
+        extremes.push_back(*std::max_element(
+            items.begin() + static_cast<std::ptrdiff_t>(i - width),
+            items.begin() + static_cast<std::ptrdiff_t>(i), compare));
+
+    return extremes;
+}
+
+// object whose copy constructor throws once the countdown reaches zero
+struct ThrowingCopy {
+
+    static inline int s_countdown{-1};
+
+    int value{0};
+
+    explicit ThrowingCopy(int v): value{v} {}
+    ThrowingCopy(const ThrowingCopy& other): value{other.value} {
+        if (s_countdown > 0 && --s_countdown == 0)
+            throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+
+    friend bool operator<(const ThrowingCopy& a, const ThrowingCopy& b)
+        { return a.value < b.value; }
+};
+
+}
+
+void testMonotonicDeque() {
+
+    Test::reset();
+    std::cout << "***** Monotonic Deque *****" << '\n';
+
+    MonotonicDeque<int> window{};
+    Test::ASSERT(window.isEmpty() && window.size() == 0,
+                 "MonotonicDeque: new, empty"); // #1
+
+    int caught{0};
+    try {
+        window.front();
+    } catch (const std::out_of_range&) {
+        ++caught;
+    }
+    try {
+        window.pop();
+    } catch (const std::out_of_range&) {
+        ++caught;
+    }
+    Test::ASSERT(caught == 2, "MonotonicDeque: empty, exceptions"); // #2
+
+    window.push(3);
+    window.push(1);
+    window.push(2);
+    bool extreme{window.size() == 3 && window.front() == 3};
+    window.pop();
+    extreme &= (window.size() == 2 && window.front() == 2);
+    window.pop();
+    extreme &= (window.size() == 1 && window.front() == 2);
+    window.pop();
+    extreme &= window.isEmpty();
+    Test::ASSERT(extreme, "MonotonicDeque: push, pop, max"); // #3
+
+    // random pushes and pops, compared with a rescan of the window, for
+    // both the maximum and the minimum
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> value{0, 99};
+    std::uniform_int_distribution<int> op{0, 2};
+
+    MonotonicDeque<int> max_window{};
+    MonotonicDeque<int, std::greater<int>> min_window{};
+    std::deque<int> naive{};
+    bool matched{true};
+    for (int i{0}; i < 100'000; ++i) {
+
+        if (op(gen) > 0 || naive.empty()) {
+            int v{value(gen)};
+            max_window.push(v);
+            min_window.push(v);
+            naive.push_back(v);
+        } else {
+            max_window.pop();
+            min_window.pop();
+            naive.pop_front();
+        }
+
+        if (naive.empty())
+            continue;
+        matched &= (max_window.front() ==
+                    *std::max_element(naive.begin(), naive.end()));
+        matched &= (min_window.front() ==
+                    *std::min_element(naive.begin(), naive.end()));
+        matched &= (max_window.size() == static_cast<int>(naive.size()));
+    }
+    Test::ASSERT(matched, "MonotonicDeque: random, min and max"); // #4
+
+    // a window slid over a span gives the extreme of every full window
+    std::vector<int> items(10'000);
+    for (int& i : items)
+        i = value(gen);
+
+    const int width{50};
+    std::vector<int> extremes(items.size());
+    MonotonicDeque<int> slider{};
+    int written{slider.slide(items, width, extremes)};
+    extremes.resize(static_cast<std::size_t>(written));
+    Test::ASSERT(written == static_cast<int>(items.size()) - width + 1 &&
+                 extremes == rescanWindows(items, width, std::less<int>{}),
+                 "MonotonicDeque: slide, max"); // #5
+    Test::ASSERT(slider.size() == width, "MonotonicDeque: size"); // #6
+
+    // a stream slid a span at a time gives the same extremes
+    MonotonicDeque<int, std::greater<int>> stream{};
+    std::vector<int> chunk(items.size());
+    std::vector<int> chunked{};
+    std::span<const int> rest{items};
+    for (std::size_t n : {7u, 1u, 43u, 500u, 9'449u}) {
+        int w{stream.slide(rest.first(n), width, chunk)};
+        chunked.insert(chunked.end(), chunk.begin(), chunk.begin() + w);
+        rest = rest.subspan(n);
+    }
+    Test::ASSERT(rest.empty() &&
+                 chunked == rescanWindows(items, width, std::greater<int>{}),
+                 "MonotonicDeque: slide in chunks, min"); // #7
+
+    // a window of width one gives back every object
+    MonotonicDeque<int> single{};
+    extremes.assign(items.size(), -1);
+    written = single.slide(items, 1, extremes);
+    Test::ASSERT(written == static_cast<int>(items.size()) &&
+                 extremes == items, "MonotonicDeque: slide, width 1"); // #8
+
+    // objects of a type that allocates
+    MonotonicDeque<std::string> words{};
+    for (const char* w : {"pear", "apple", "plum", "fig"})
+        words.push(w);
+    bool strings{words.front() == "plum"};
+    words.pop();
+    words.pop();
+    words.pop();
+    strings &= (words.front() == "fig");
+    Test::ASSERT(strings, "MonotonicDeque: strings"); // #9
+
+    words.clear();
+    Test::ASSERT(words.isEmpty(), "MonotonicDeque: clear"); // #10
+
+    // a push that fails after discarding outranked objects clears the
+    // window, rather than leaving a size without an extreme
+    MonotonicDeque<ThrowingCopy> failing{};
+    for (int i{0}; i < 4; ++i)
+        failing.push(ThrowingCopy{i});
+    ThrowingCopy::s_countdown = 1;
+    bool cleared{false};
+    try {
+        failing.push(ThrowingCopy{10});
+    } catch (const std::runtime_error&) {
+        cleared = failing.isEmpty() && failing.size() == 0;
+    }
+    ThrowingCopy::s_countdown = -1;
+    failing.push(ThrowingCopy{5});
+    cleared &= (failing.size() == 1 && failing.front().value == 5);
+    Test::ASSERT(cleared, "MonotonicDeque: failed push clears"); // #11
+
+    Test::runReport();
+    std::cout << "***************************" << '\n' << '\n';
+}
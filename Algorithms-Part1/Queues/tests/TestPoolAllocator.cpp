@@ -0,0 +1,130 @@
+/**
+ * \file    TestPoolAllocator.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for BlockPool and PoolAllocator classes.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Deque.h"
+#include "PoolAllocator.h"
+#include "Test.h"
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+void testBlockPool();
+void testPoolAllocatorDeque();
+
+void testPoolAllocator() {
+
+    testBlockPool();
+    testPoolAllocatorDeque();
+}
+
+void testBlockPool() {
+
+    Test::reset();
+    std::cout << "***** Block Pool *****" << '\n';
+
+    BlockPool pool{100, 4};
+
+    Test::ASSERT(pool.chunkBytes() % alignof(std::max_align_t) == 0 &&
+                 pool.chunkBytes() >= 100, "Pool: chunk size rounded"); // #1
+    Test::ASSERT(pool.slabs() == 0, "Pool: no slabs until used"); // #2
+
+    void* a{pool.allocate(100)};
+    void* b{pool.allocate(50)};
+    Test::ASSERT(pool.slabs() == 1 && pool.chunksInUse() == 2,
+                 "Pool: chunks from first slab"); // #3
+
+    pool.deallocate(b, 50);
+    void* c{pool.allocate(80)};
+    Test::ASSERT(c == b, "Pool: released chunk reused"); // #4
+
+    void* d{pool.allocate(100)};
+    void* e{pool.allocate(100)};
+    void* f{pool.allocate(100)};
+    Test::ASSERT(pool.slabs() == 2 && pool.chunksInUse() == 5,
+                 "Pool: second slab when first exhausted"); // #5
+
+    void* big{pool.allocate(1'000)};
+    Test::ASSERT(pool.heapFallbacks() == 1 && pool.chunksInUse() == 5,
+                 "Pool: large request from heap"); // #6
+    pool.deallocate(big, 1'000);
+
+    pool.deallocate(a, 100);
+    pool.deallocate(c, 80);
+    pool.deallocate(d, 100);
+    pool.deallocate(e, 100);
+    pool.deallocate(f, 100);
+    Test::ASSERT(pool.chunksInUse() == 0, "Pool: all chunks released"); // #7
+
+    Test::runReport();
+    std::cout << "**********************" << '\n' << '\n';
+}
+
+void testPoolAllocatorDeque() {
+
+    Test::reset();
+    std::cout << "***** Pool Allocator Deque *****" << '\n';
+
+    using Allocator = PoolAllocator<int>;
+
+    Allocator alloc{Deque<int, Allocator>::block_bytes};
+    Deque<int, Allocator> d{alloc};
+
+    // first burst grows the pool to its peak size
+    for (int i{0}; i < 10'000; ++i)
+        d.addLast(i);
+    while (!d.isEmpty())
+        d.removeFirst();
+
+    int peak_slabs{alloc.pool()->slabs()};
+    Test::ASSERT(peak_slabs > 0, "Pool Deque: blocks from pool"); // #1
+
+    // subsequent bursts, in either direction, reuse pool chunks
+    bool in_order{true};
+    for (int burst{0}; burst < 100; ++burst) {
+
+        for (int i{0}; i < 10'000; ++i) {
+            if (burst % 2 == 0)
+                d.addLast(i);
+            else
+                d.addFirst(i);
+        }
+
+        for (int i{0}; i < 10'000; ++i)
+            in_order &= (d.removeFirst() == (burst % 2 == 0 ? i : 9'999 - i));
+    }
+    Test::ASSERT(in_order, "Pool Deque: bursts, removed in order"); // #2
+    Test::ASSERT(alloc.pool()->slabs() == peak_slabs,
+                 "Pool Deque: steady state, no new slabs"); // #3
+    Test::ASSERT(alloc.pool()->heapFallbacks() == 0,
+                 "Pool Deque: steady state, no heap fallbacks"); // #4
+
+    d.clear();
+    Test::ASSERT(alloc.pool()->chunksInUse() == 0,
+                 "Pool Deque: clear releases chunks"); // #5
+
+    // the pool outlives the allocator that created it
+    {
+        Deque<std::string, PoolAllocator<std::string>> s{
+            PoolAllocator<std::string>{
+                Deque<std::string>::block_bytes}};
+
+        for (int i{0}; i < 1'000; ++i)
+            s.addFirst(std::to_string(i) +
+                       " is a long enough string to allocate");
+        for (int i{0}; i < 500; ++i)
+            s.removeLast();
+
+        Test::ASSERT(s.size() == 500 && *s.begin() ==
+                     "999 is a long enough string to allocate",
+                     "Pool Deque: strings"); // #6
+    }
+
+    Test::runReport();
+    std::cout << "********************************" << '\n' << '\n';
+}
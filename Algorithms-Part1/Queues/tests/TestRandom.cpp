@@ -0,0 +1,117 @@
+/**
+ * \file    TestRandom.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for Random namespace.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Random.h"
+#include "Test.h"
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+void testRandom() {
+
+    Test::reset();
+    std::cout << "***** Random *****" << '\n';
+
+    // engines seeded alike produce the same sequence
+    Random::Xoshiro256 a{42};
+    Random::Xoshiro256 b{42};
+    Random::Xoshiro256 c{43};
+    std::uint64_t first_a{a()};
+    Test::ASSERT(first_a == b() && a() == b(),
+                 "Random: same seed, same sequence"); // #1
+    Test::ASSERT(first_a != c(), "Random: other seed, other sequence"); // #2
+
+    // usable with the standard distributions
+    std::uniform_real_distribution<double> real{0.0, 1.0};
+    double r{real(a)};
+    Test::ASSERT(r >= 0.0 && r < 1.0, "Random: standard distribution"); // #3
+
+    // bounds, including ranges of a single number and of all ints
+    bool in_range{true};
+    for (int i{0}; i < 10'000; ++i) {
+        int x{Random::getRandomNumber(-5, 5)};
+        in_range &= (x >= -5 && x <= 5);
+        in_range &= (Random::getRandomNumber(7, 7) == 7);
+        in_range &= (Random::getRandomNumber(INT_MAX - 1, INT_MAX) >=
+                     INT_MAX - 1);
+    }
+    Test::ASSERT(in_range, "Random: number in range"); // #4
+
+    bool negative{false};
+    bool positive{false};
+    for (int i{0}; i < 100; ++i) {
+        int x{Random::getRandomNumber(INT_MIN, INT_MAX)};
+        negative |= (x < 0);
+        positive |= (x > 0);
+    }
+    Test::ASSERT(negative && positive, "Random: full range of int"); // #5
+
+    // uniform; chi-square test with 9 degrees of freedom at a significance
+    // level of 0.001, for single numbers and for a batch
+    const int    n{10};
+    const int    draws{100'000};
+    const double critical{27.88};
+
+    std::vector<int> single(n, 0);
+    for (int i{0}; i < draws; ++i)
+        ++single[static_cast<std::size_t>(Random::getRandomNumber(0, n - 1))];
+
+    std::vector<int> numbers(draws);
+    Random::getRandomNumbers(1, n, numbers);
+    std::vector<int> batch(n, 0);
+    bool batch_in_range{true};
+    for (int x : numbers) {
+        batch_in_range &= (x >= 1 && x <= n);
+        if (x >= 1 && x <= n)
+            ++batch[static_cast<std::size_t>(x - 1)];
+    }
+    Test::ASSERT(batch_in_range, "Random: batch in range"); // #6
+
+    double expected{static_cast<double>(draws) / n};
+    double chi2_single{0.0};
+    double chi2_batch{0.0};
+    for (int i{0}; i < n; ++i) {
+        double d_single{single[static_cast<std::size_t>(i)] - expected};
+        double d_batch{batch[static_cast<std::size_t>(i)] - expected};
+        chi2_single += d_single * d_single / expected;
+        chi2_batch += d_batch * d_batch / expected;
+    }
+    std::cout << "chi-square: single " << chi2_single << ", batch "
+              << chi2_batch << '\n';
+    Test::ASSERT(chi2_single < critical, "Random: single uniform"); // #7
+    Test::ASSERT(chi2_batch < critical, "Random: batch uniform"); // #8
+
+    // a range that is not a power of two, and near 2^32, where rejection is
+    // most frequent, is still uniform across its halves
+    const int halves_draws{20'000};
+    int low_half{0};
+    for (int i{0}; i < halves_draws; ++i)
+        low_half += (Random::getRandomNumber(INT_MIN + 1, INT_MAX) < 0);
+    double z{(low_half - halves_draws / 2.0) /
+             std::sqrt(halves_draws / 4.0)};
+    Test::ASSERT(z > -3.3 && z < 3.3, "Random: large range uniform"); // #9
+
+    // reseeding reproduces the sequence, for single numbers and batches
+    Random::seed(2024);
+    int x1{Random::getRandomNumber(0, 1'000'000)};
+    std::vector<int> batch1(5);
+    Random::getRandomNumbers(0, 1'000'000, batch1);
+    Random::seed(2024);
+    int x2{Random::getRandomNumber(0, 1'000'000)};
+    std::vector<int> batch2(5);
+    Random::getRandomNumbers(0, 1'000'000, batch2);
+    Test::ASSERT(x1 == x2 && batch1 == batch2,
+                 "Random: reseed reproduces"); // #10
+
+    Test::runReport();
+    std::cout << "******************" << '\n' << '\n';
+}
@@ -9,22 +9,42 @@
 
 #include "RandomQueue.h"
 #include "Test.h"
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <new>          // for std::bad_alloc
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>      // for std::declval
+#include <vector>
 
 void testRQBasicOperation();
 void testRQExceptions();
 void testRQIterators();
+void testRQIteratorOrder();
+void testRQBatch();
+void testRQCapacity();
+void testRQMove();
+void testRQStorage();
+void testRQInline();
 void printRQ(const RandomQueue<int>& q);
 void printRQ(const RandomQueue<std::string_view>& q);
 
+static_assert(noexcept(std::declval<RandomQueue<int>&>().tryDequeue()));
+
 void testRandomQueue() {
 
     testRQBasicOperation();
     testRQExceptions();
     testRQIterators();
+    testRQIteratorOrder();
+    testRQBatch();
+    testRQCapacity();
+    testRQMove();
+    testRQStorage();
+    testRQInline();
 }
 
 void testRQBasicOperation() {
@@ -221,6 +241,20 @@ void testRQExceptions() {
     valid_message = "SHOULD catch an error: queue empty, no such element";
     Test::ASSERT((ss.str() == valid_message), "RQ: exception"); // #4
 
+    // tryDequeue neither throws nor logs on an empty queue
+    std::stringstream log{};
+    std::streambuf* cerr_buf{std::cerr.rdbuf(log.rdbuf())};
+    bool tried{!q.tryDequeue().has_value()};
+    for (int i{0}; i < 100; ++i)
+        q.enqueue(i);
+    int sum{0};
+    while (std::optional<int> item{q.tryDequeue()})
+        sum += *item;
+    tried &= !q.tryDequeue().has_value();
+    std::cerr.rdbuf(cerr_buf);
+    Test::ASSERT(tried && sum == 4'950 && q.capacity() == 2 &&
+                 log.str().empty(), "RQ: try dequeue"); // #5
+
     Test::runReport();
     std::cout << "***********************************" << '\n' << '\n';
 }
@@ -306,6 +340,627 @@ void testRQIterators() {
 
 }
 
+void testRQIteratorOrder() {
+
+    Test::reset();
+    std::cout << "***** Random Queue Iterator Order *****" << '\n';
+
+    // each object is returned exactly once, for sizes on either side of the
+    // powers of four over which the permutation is generated
+    bool once{true};
+    for (int n : {0, 1, 2, 3, 4, 5, 15, 16, 17, 63, 64, 65, 1'000, 4'097}) {
+
+        RandomQueue<int> q{};
+        for (int i{0}; i < n; ++i)
+            q.enqueue(i);
+
+        std::vector<int> seen(static_cast<std::size_t>(n), 0);
+        int count{0};
+        for (int i : q) {
+            ++seen[static_cast<std::size_t>(i)];
+            ++count;
+        }
+
+        once &= (count == n);
+        for (int s : seen)
+            once &= (s == 1);
+    }
+    Test::ASSERT(once, "RQ: iterator returns each object once"); // #1
+
+    RandomQueue<int> q{};
+    const int n{10};
+    for (int i{0}; i < n; ++i)
+        q.enqueue(i);
+
+    // the non-random iterator returns the queue as stored, last to first
+    const int* stored_last{&*q.tbegin()};
+    bool stored_order{true};
+    int count{0};
+    for (RandomQueue<int>::const_iterator it{q.tbegin()}; it != q.tend();
+         ++it, ++count)
+        stored_order &= (&*it == stored_last - count);
+    Test::ASSERT(stored_order && count == n,
+                 "RQ: non-random iterator in stored order"); // #2
+
+    // the object at each position is close to uniform; chi-square test with
+    // 9 degrees of freedom at a significance level of 0.001
+    const int    trials{20'000};
+    const double critical{27.88};
+
+    std::vector<int> first(n, 0);
+    std::vector<int> last(n, 0);
+    for (int t{0}; t < trials; ++t) {
+
+        RandomQueue<int>::const_iterator it{q.begin()};
+        ++first[static_cast<std::size_t>(*it)];
+        for (int i{1}; i < n - 1; ++i)
+            ++it;
+        ++last[static_cast<std::size_t>(*it)];
+    }
+
+    double chi2_first{0.0};
+    double chi2_last{0.0};
+    double expected{static_cast<double>(trials) / n};
+    for (int i{0}; i < n; ++i) {
+        double d_first{first[static_cast<std::size_t>(i)] - expected};
+        double d_last{last[static_cast<std::size_t>(i)] - expected};
+        chi2_first += d_first * d_first / expected;
+        chi2_last += d_last * d_last / expected;
+    }
+    std::cout << "chi-square: first " << chi2_first << ", last " << chi2_last
+              << '\n';
+
+    Test::ASSERT(chi2_first < critical, "RQ: first object uniform"); // #3
+    Test::ASSERT(chi2_last < critical, "RQ: last object uniform"); // #4
+
+    // iterators are independent; two orders of 100 objects coincide with
+    // negligible probability
+    RandomQueue<int> big{};
+    for (int i{0}; i < 100; ++i)
+        big.enqueue(i);
+
+    bool differ{false};
+    RandomQueue<int>::const_iterator a{big.begin()};
+    RandomQueue<int>::const_iterator b{big.begin()};
+    for (; a != big.end(); ++a, ++b)
+        differ |= (*a != *b);
+    Test::ASSERT(differ, "RQ: iterators independent"); // #5
+
+    Test::runReport();
+    std::cout << "***************************************" << '\n' << '\n';
+}
+
+void testRQBatch() {
+
+    Test::reset();
+    std::cout << "***** Random Queue Batch *****" << '\n';
+
+    const int n{1'000};
+    std::vector<int> values(n);
+    for (int i{0}; i < n; ++i)
+        values[static_cast<std::size_t>(i)] = i;
+
+    // a forward range is added with a single resize
+    RandomQueue<int> q{};
+    q.enqueueRange(values.begin(), values.end());
+    Test::ASSERT(q.size() == n && q.capacity() == 1'024,
+                 "RQ: enqueueRange size, capacity"); // #1
+
+    std::vector<int> stored{};
+    for (RandomQueue<int>::const_iterator it{q.tbegin()}; it != q.tend(); ++it)
+        stored.push_back(*it);
+    std::sort(stored.begin(), stored.end());
+    Test::ASSERT(stored == values, "RQ: enqueueRange contents"); // #2
+
+    // an input range is added one object at a time
+    std::stringstream ss{"1 2 3 4 5"};
+    RandomQueue<int> from_stream{};
+    from_stream.enqueueRange(std::istream_iterator<int>{ss},
+                             std::istream_iterator<int>{});
+    Test::ASSERT(from_stream.size() == 5, "RQ: enqueueRange input"); // #3
+
+    // sampling copies distinct objects, and leaves the queue unchanged
+    std::vector<int> before{};
+    for (RandomQueue<int>::const_iterator it{q.tbegin()}; it != q.tend(); ++it)
+        before.push_back(*it);
+
+    std::vector<int> sampled{};
+    q.sampleK(100, std::back_inserter(sampled));
+    std::vector<int> after{};
+    for (RandomQueue<int>::const_iterator it{q.tbegin()}; it != q.tend(); ++it)
+        after.push_back(*it);
+
+    std::sort(sampled.begin(), sampled.end());
+    Test::ASSERT(sampled.size() == 100 &&
+                 std::adjacent_find(sampled.begin(), sampled.end()) ==
+                     sampled.end(),
+                 "RQ: sampleK distinct"); // #4
+    Test::ASSERT(before == after && q.size() == n,
+                 "RQ: sampleK leaves queue unchanged"); // #5
+
+    std::vector<int> all{};
+    q.sampleK(n, std::back_inserter(all));
+    std::sort(all.begin(), all.end());
+    Test::ASSERT(all == values, "RQ: sampleK entire queue"); // #6
+
+    // removing a batch resizes once, to the capacity single removals reach
+    std::vector<int> removed{};
+    q.dequeueN(900, std::back_inserter(removed));
+    Test::ASSERT(q.size() == 100 && q.capacity() == 256,
+                 "RQ: dequeueN size, capacity"); // #7
+
+    while (!q.isEmpty())
+        removed.push_back(q.dequeue());
+    std::sort(removed.begin(), removed.end());
+    Test::ASSERT(removed == values, "RQ: dequeueN each object once"); // #8
+    Test::ASSERT(q.capacity() == 2, "RQ: dequeueN capacity empty"); // #9
+
+    // too few objects; nothing is removed
+    q.enqueue(1);
+    q.enqueue(2);
+    bool caught{false};
+    try {
+        q.dequeueN(3, std::back_inserter(removed));
+    } catch (const std::out_of_range& e) {
+        caught = true;
+    }
+    Test::ASSERT(caught && q.size() == 2, "RQ: dequeueN too many"); // #10
+
+    caught = false;
+    try {
+        q.sampleK(3, std::back_inserter(sampled));
+    } catch (const std::out_of_range& e) {
+        caught = true;
+    }
+    Test::ASSERT(caught && q.size() == 2, "RQ: sampleK too many"); // #11
+
+    // a negative count is rejected like a count too large
+    int rejected{0};
+    try {
+        q.dequeueN(-1, std::back_inserter(removed));
+    } catch (const std::out_of_range& e) {
+        ++rejected;
+    }
+    try {
+        q.sampleK(-1, std::back_inserter(sampled));
+    } catch (const std::out_of_range& e) {
+        ++rejected;
+    }
+    Test::ASSERT(rejected == 2 && q.size() == 2,
+                 "RQ: dequeueN, sampleK negative"); // #12
+
+    // each object is equally likely to be sampled; chi-square test with 9
+    // degrees of freedom at a significance level of 0.001
+    RandomQueue<int> small{};
+    small.enqueueRange(values.begin(), values.begin() + 10);
+
+    const int trials{10'000};
+    std::vector<int> counts(10, 0);
+    for (int t{0}; t < trials; ++t) {
+        int picked[3]{};
+        small.sampleK(3, picked);
+        for (int p : picked)
+            ++counts[static_cast<std::size_t>(p)];
+    }
+
+    double expected{3.0 * trials / 10};
+    double chi2{0.0};
+    for (int c : counts)
+        chi2 += (c - expected) * (c - expected) / expected;
+    std::cout << "chi-square: sampleK " << chi2 << '\n';
+    Test::ASSERT(chi2 < 27.88, "RQ: sampleK uniform"); // #13
+
+    Test::runReport();
+    std::cout << "******************************" << '\n' << '\n';
+}
+
+void testRQCapacity() {
+
+    Test::reset();
+    std::cout << "***** Random Queue Capacity *****" << '\n';
+
+    // reserve resizes once, to exactly the reserved capacity
+    RandomQueue<int> q{};
+    q.reserve(1'000);
+    Test::ASSERT(q.capacity() == 1'000, "RQ: reserve capacity"); // #1
+
+    for (int i{0}; i < 1'000; ++i)
+        q.enqueue(i);
+    Test::ASSERT(q.capacity() == 1'000, "RQ: reserve no resize"); // #2
+
+    // a smaller reservation does not reduce the capacity
+    q.reserve(10);
+    Test::ASSERT(q.capacity() == 1'000, "RQ: reserve smaller"); // #3
+
+    q.reserve(1'000);
+    for (int i{0}; i < 900; ++i)
+        q.dequeue();
+    Test::ASSERT(q.size() == 100 && q.capacity() == 1'000,
+                 "RQ: no shrink below reserve"); // #4
+
+    // shrinking to fit releases the reservation, and keeps every object
+    q.shrinkToFit();
+    Test::ASSERT(q.capacity() == 100, "RQ: shrinkToFit capacity"); // #5
+
+    std::vector<int> kept{};
+    for (RandomQueue<int>::const_iterator it{q.tbegin()}; it != q.tend(); ++it)
+        kept.push_back(*it);
+    std::sort(kept.begin(), kept.end());
+    Test::ASSERT(kept.size() == 100 &&
+                 std::adjacent_find(kept.begin(), kept.end()) == kept.end(),
+                 "RQ: shrinkToFit contents"); // #6
+
+    q.enqueue(-1);
+    Test::ASSERT(q.capacity() == 200, "RQ: grow after shrinkToFit"); // #7
+
+    while (q.size() > 25)
+        q.dequeue();
+    Test::ASSERT(q.capacity() == 50, "RQ: shrink after shrinkToFit"); // #8
+
+    RandomQueue<int> empty{};
+    empty.shrinkToFit();
+    Test::ASSERT(empty.capacity() == 2, "RQ: shrinkToFit empty"); // #9
+
+    // clear releases the reservation
+    q.reserve(500);
+    q.clear();
+    Test::ASSERT(q.capacity() == 2, "RQ: clear releases reserve"); // #10
+
+    // a queue that never shrinks keeps its largest capacity
+    RandomQueue<int> never{GrowthPolicy::neverShrink()};
+    for (int i{0}; i < 1'000; ++i)
+        never.enqueue(i);
+    while (!never.isEmpty())
+        never.dequeue();
+    Test::ASSERT(never.capacity() == 1'024, "RQ: never shrink"); // #11
+
+    std::vector<int> out{};
+    never.enqueue(1);
+    never.dequeueN(1, std::back_inserter(out));
+    Test::ASSERT(never.capacity() == 1'024,
+                 "RQ: never shrink dequeueN"); // #12
+
+    // a custom policy: grow by four, shrink at one sixteenth full
+    RandomQueue<int> custom{GrowthPolicy{4, 16}};
+    for (int i{0}; i < 9; ++i)
+        custom.enqueue(i);
+    Test::ASSERT(custom.capacity() == 32, "RQ: custom growth"); // #13
+
+    for (int i{0}; i < 7; ++i)
+        custom.dequeue();
+    Test::ASSERT(custom.capacity() == 8 && custom.size() == 2,
+                 "RQ: custom shrink"); // #14
+
+    // the size oscillates across the default policy's resize points, but
+    // within the wider hysteresis of a shrink ratio of eight
+    RandomQueue<int> wide{GrowthPolicy{2, 8}};
+    for (int i{0}; i < 600; ++i)
+        wide.enqueue(i);
+    bool steady{true};
+    for (int cycle{0}; cycle < 10; ++cycle) {
+        while (wide.size() > 200)
+            wide.dequeue();
+        steady &= (wide.capacity() == 1'024);
+        while (wide.size() < 600)
+            wide.enqueue(cycle);
+        steady &= (wide.capacity() == 1'024);
+    }
+    Test::ASSERT(steady, "RQ: wide hysteresis"); // #15
+
+    Test::runReport();
+    std::cout << "*********************************" << '\n' << '\n';
+}
+
+namespace {
+
+// counts copies, to verify that the queue does not copy objects
+struct Tracked {
+
+    static inline int s_copies{0};
+
+    int value{0};
+
+    Tracked() = default;
+    Tracked(int v, int w): value{v + w} {}
+    Tracked(const Tracked& other): value{other.value} { ++s_copies; }
+    Tracked(Tracked&& other) noexcept = default;
+    Tracked& operator= (const Tracked& other)
+        { value = other.value; ++s_copies; return *this; }
+    Tracked& operator= (Tracked&& other) noexcept = default;
+};
+
+// not DefaultConstructible; counts live instances and move constructions
+struct Counted {
+
+    static inline int s_live{0};
+    static inline int s_move_constructs{0};
+
+    int value{0};
+
+    Counted() = delete;
+    explicit Counted(int v): value{v} { ++s_live; }
+    Counted(const Counted& other): value{other.value} { ++s_live; }
+    Counted(Counted&& other) noexcept: value{other.value}
+        { ++s_live; ++s_move_constructs; }
+    Counted& operator= (const Counted& other) = default;
+    Counted& operator= (Counted&& other) noexcept = default;
+    ~Counted() { --s_live; }
+};
+
+// allocator that counts outstanding allocations
+template <typename T>
+struct CountingAllocator {
+
+    using value_type = T;
+
+    static inline int s_outstanding{0};
+    static inline int s_allocations{0};
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        ++s_outstanding;
+        ++s_allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) {
+        --s_outstanding;
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    friend bool operator==(const CountingAllocator&, const CountingAllocator&)
+        { return true; }
+};
+
+// allocator that fails, once told to
+template <typename T>
+struct FailingAllocator {
+
+    using value_type = T;
+
+    static inline bool s_fail{false};
+
+    FailingAllocator() = default;
+    template <typename U>
+    FailingAllocator(const FailingAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        if (s_fail)
+            throw std::bad_alloc{};
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    friend bool operator==(const FailingAllocator&, const FailingAllocator&)
+        { return true; }
+};
+
+}
+
+void testRQMove() {
+
+    Test::reset();
+    std::cout << "***** Random Queue Move *****" << '\n';
+
+    // move-only objects
+    RandomQueue<std::unique_ptr<int>> p{};
+    for (int i{0}; i < 100; ++i)
+        p.enqueue(std::make_unique<int>(i));
+
+    std::unique_ptr<int> ptr{std::make_unique<int>(100)};
+    p.enqueue(std::move(ptr));
+    p.emplace(new int{101});
+    Test::ASSERT(ptr == nullptr && p.size() == 102,
+                 "RQ: move-only enqueue"); // #1
+
+    std::vector<int> values{};
+    while (!p.isEmpty())
+        values.push_back(*p.dequeue());
+    std::sort(values.begin(), values.end());
+
+    bool all_values{values.size() == 102};
+    for (std::size_t i{0}; all_values && i < values.size(); ++i)
+        all_values = (values[i] == static_cast<int>(i));
+    Test::ASSERT(all_values, "RQ: move-only dequeue"); // #2
+
+    // objects are moved, not copied, in, within, and out of the queue
+    Tracked::s_copies = 0;
+
+    RandomQueue<Tracked> t{};
+    int sum{0};
+    for (int i{0}; i < 1'000; ++i) {
+        t.emplace(i, 1);
+        t.enqueue(Tracked{i, 2});
+        sum += 2 * i + 3;
+    }
+    Test::ASSERT(Tracked::s_copies == 0, "RQ: emplace, enqueue rvalue"); // #3
+
+    int dequeued_sum{0};
+    while (!t.isEmpty())
+        dequeued_sum += t.dequeue().value;
+    Test::ASSERT(Tracked::s_copies == 0, "RQ: dequeue, moved"); // #4
+    Test::ASSERT(dequeued_sum == sum, "RQ: dequeue, values"); // #5
+
+    Tracked item{1, 1};
+    t.enqueue(item);
+    Test::ASSERT(Tracked::s_copies == 1, "RQ: enqueue lvalue, copied"); // #6
+
+    Test::runReport();
+    std::cout << "*****************************" << '\n' << '\n';
+}
+
+void testRQStorage() {
+
+    Test::reset();
+    std::cout << "***** Random Queue Storage *****" << '\n';
+
+    using Allocator = CountingAllocator<Counted>;
+
+    {
+        RandomQueue<Counted, Allocator> q{};
+        Test::ASSERT(Counted::s_live == 0, "RQ: no objects constructed"); // #1
+
+        // growth moves each live object exactly once, plus at most one move
+        // construction for the swap that places the new object
+        bool moved_once{true};
+        for (int i{0}; i < 1'024; ++i) {
+
+            int capacity{q.capacity()};
+            int moves{Counted::s_move_constructs};
+            q.emplace(i);
+
+            int grown_moves{Counted::s_move_constructs - moves};
+            if (q.capacity() != capacity)
+                moved_once &= (grown_moves == capacity ||
+                               grown_moves == capacity + 1);
+            else
+                moved_once &= (grown_moves <= 1);
+        }
+        Test::ASSERT(moved_once, "RQ: growth moves each object once"); // #2
+        Test::ASSERT(Counted::s_live == 1'024, "RQ: live objects"); // #3
+        Test::ASSERT(Allocator::s_allocations == 10,
+                     "RQ: one allocation per growth"); // #4
+
+        for (int i{0}; i < 1'000; ++i)
+            q.dequeue();
+        Test::ASSERT(Counted::s_live == 24,
+                     "RQ: dequeue destroys objects"); // #5
+        Test::ASSERT(q.capacity() == 64, "RQ: shrunk capacity"); // #6
+
+        q.clear();
+        Test::ASSERT(Counted::s_live == 0,
+                     "RQ: clear destroys objects"); // #7
+        Test::ASSERT(Allocator::s_outstanding == 1,
+                     "RQ: clear releases memory"); // #8
+
+        for (int i{0}; i < 100; ++i)
+            q.enqueue(Counted{i});
+    }
+    Test::ASSERT(Counted::s_live == 0,
+                 "RQ: destructor destroys objects"); // #9
+    Test::ASSERT(Allocator::s_outstanding == 0,
+                 "RQ: destructor releases memory"); // #10
+
+    // tryDequeue keeps the larger array, silently, if it fails to shrink
+    RandomQueue<int, FailingAllocator<int>> f{};
+    for (int i{0}; i < 64; ++i)
+        f.enqueue(i);
+    FailingAllocator<int>::s_fail = true;
+    std::stringstream log{};
+    std::streambuf* cerr_buf{std::cerr.rdbuf(log.rdbuf())};
+    int sum{0};
+    while (std::optional<int> item{f.tryDequeue()})
+        sum += *item;
+    std::cerr.rdbuf(cerr_buf);
+    FailingAllocator<int>::s_fail = false;
+    Test::ASSERT(sum == 2'016 && f.capacity() == 64 && log.str().empty(),
+                 "RQ: try dequeue, shrink fails"); // #11
+
+    Test::runReport();
+    std::cout << "********************************" << '\n' << '\n';
+}
+
+void testRQInline() {
+
+    Test::reset();
+    std::cout << "***** Random Queue Inline *****" << '\n';
+
+    using Allocator = CountingAllocator<int>;
+
+    {
+        SmallRandomQueue<int, 16, Allocator> q{};
+        Test::ASSERT(q.isInline() && q.capacity() == 16 &&
+                     Allocator::s_allocations == 0,
+                     "RQ: inline, no allocation"); // #1
+
+        // up to N objects are held inline, in random order
+        for (int i{0}; i < 16; ++i)
+            q.enqueue(i);
+        Test::ASSERT(q.isInline() && Allocator::s_allocations == 0,
+                     "RQ: N objects inline"); // #2
+
+        // the next object grows the queue into allocated memory
+        q.enqueue(16);
+        Test::ASSERT(!q.isInline() && q.capacity() == 32 &&
+                     Allocator::s_outstanding == 1,
+                     "RQ: grow beyond N"); // #3
+
+        // shrinking back to N returns to the inline storage
+        std::vector<int> values{};
+        while (q.size() > 4)
+            values.push_back(q.dequeue());
+        Test::ASSERT(q.isInline() && q.capacity() == 16 &&
+                     Allocator::s_outstanding == 0,
+                     "RQ: shrink to inline"); // #4
+
+        while (!q.isEmpty())
+            values.push_back(q.dequeue());
+        std::sort(values.begin(), values.end());
+        bool all_values{values.size() == 17};
+        for (std::size_t i{0}; all_values && i < values.size(); ++i)
+            all_values = (values[i] == static_cast<int>(i));
+        Test::ASSERT(all_values, "RQ: inline, all dequeued"); // #5
+
+        // reserved capacity is allocated; shrinkToFit returns inline
+        q.reserve(100);
+        q.enqueue(1);
+        bool reserved{!q.isInline() && q.capacity() == 100};
+        q.shrinkToFit();
+        reserved &= (q.isInline() && q.size() == 1 && q.sample() == 1);
+        Test::ASSERT(reserved, "RQ: inline, reserve, shrink to fit"); // #6
+
+        for (int i{0}; i < 1'000; ++i)
+            q.enqueue(i);
+        q.clear();
+        Test::ASSERT(q.isInline() && q.isEmpty() &&
+                     Allocator::s_outstanding == 0,
+                     "RQ: inline, clear"); // #7
+
+        // a queue of ten objects, filled and emptied repeatedly, as on a
+        // per-request path, allocates nothing
+        int allocations{Allocator::s_allocations};
+        for (int r{0}; r < 100; ++r) {
+            for (int i{0}; i < 10; ++i)
+                q.enqueue(i);
+            while (!q.isEmpty())
+                q.dequeue();
+        }
+        Test::ASSERT(Allocator::s_allocations == allocations,
+                     "RQ: inline, no allocation in steady state"); // #8
+    }
+
+    // each object is equally likely to be dequeued first from the inline
+    // storage; chi-square test with 15 degrees of freedom at a significance
+    // level of 0.001
+    const int    n{16};
+    const int    trials{32'000};
+    const double critical{37.70};
+
+    std::vector<int> counts(n, 0);
+    for (int t{0}; t < trials; ++t) {
+        SmallRandomQueue<int, n> q{};
+        for (int i{0}; i < n; ++i)
+            q.enqueue(i);
+        ++counts[static_cast<std::size_t>(q.dequeue())];
+    }
+
+    double expected{static_cast<double>(trials) / n};
+    double chi2{0.0};
+    for (int c : counts)
+        chi2 += (c - expected) * (c - expected) / expected;
+    std::cout << "chi-square: inline first dequeued " << chi2 << '\n';
+    Test::ASSERT(chi2 < critical, "RQ: inline, uniform"); // #9
+
+    Test::runReport();
+    std::cout << "*******************************" << '\n' << '\n';
+}
+
 void printRQ(const RandomQueue<int>& q) {
 
     if (q.isEmpty()) {
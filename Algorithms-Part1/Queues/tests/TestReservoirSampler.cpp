@@ -0,0 +1,98 @@
+/**
+ * \file    TestReservoirSampler.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for ReservoirSampler class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "RandomQueue.h"
+#include "ReservoirSampler.h"
+#include "Test.h"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+// sample k of the numbers [0, n) as the permutation client samples words;
+// returns the number of random numbers drawn by the sampler
+std::uint64_t sampleStream(int n, int k, std::vector<int>& sample) {
+
+    RandomQueue<int> reservoir{};
+    int next{0};
+    while (reservoir.size() < k && next < n)
+        reservoir.enqueue(next++);
+
+    ReservoirSampler sampler{k};
+    while (true) {
+
+        std::uint64_t skip{sampler.nextSkip()};
+        if (skip >= static_cast<std::uint64_t>(n - next))
+            break;
+        next += static_cast<int>(skip);
+
+        reservoir.sample() = next++;
+    }
+
+    sample.clear();
+    for (int i : reservoir)
+        sample.push_back(i);
+
+    return sampler.randomDraws();
+}
+
+}
+
+void testReservoirSampler() {
+
+    Test::reset();
+    std::cout << "***** Reservoir Sampler *****" << '\n';
+
+    std::vector<int> sample{};
+
+    // a stream no longer than the reservoir is kept in full
+    sampleStream(5, 5, sample);
+    Test::ASSERT(sample.size() == 5, "Reservoir: stream of k items"); // #1
+
+    // each item is equally likely to be in the sample; chi-square test with
+    // 19 degrees of freedom at a significance level of 0.001, which is
+    // conservative for counts of inclusion, whose sum is fixed
+    const int    n{20};
+    const int    k{5};
+    const int    trials{20'000};
+    const double critical{43.82};
+
+    std::vector<int> counts(n, 0);
+    bool distinct{true};
+    for (int t{0}; t < trials; ++t) {
+
+        sampleStream(n, k, sample);
+
+        std::vector<bool> seen(n, false);
+        for (int i : sample) {
+            distinct &= !seen[static_cast<std::size_t>(i)];
+            seen[static_cast<std::size_t>(i)] = true;
+            ++counts[static_cast<std::size_t>(i)];
+        }
+        distinct &= (static_cast<int>(sample.size()) == k);
+    }
+    Test::ASSERT(distinct, "Reservoir: k distinct items"); // #2
+
+    double expected{static_cast<double>(trials) * k / n};
+    double chi2{0.0};
+    for (int c : counts)
+        chi2 += (c - expected) * (c - expected) / expected;
+    std::cout << "chi-square: inclusion " << chi2 << '\n';
+    Test::ASSERT(chi2 < critical, "Reservoir: inclusion uniform"); // #3
+
+    // random numbers drawn grow with k log(n/k), not with n
+    std::uint64_t draws{sampleStream(10'000'000, 10, sample)};
+    std::cout << "random numbers drawn for n = 10^7, k = 10: " << draws
+              << '\n';
+    Test::ASSERT(draws < 1'000, "Reservoir: draws sublinear"); // #4
+
+    Test::runReport();
+    std::cout << "*****************************" << '\n' << '\n';
+}
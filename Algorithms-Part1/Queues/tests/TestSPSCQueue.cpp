@@ -0,0 +1,104 @@
+/**
+ * \file    TestSPSCQueue.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for SPSCQueue class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "SPSCQueue.h"
+#include "Test.h"
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+void testSPSCBasicOperation();
+void testSPSCThreads();
+
+void testSPSCQueue() {
+
+    testSPSCBasicOperation();
+    testSPSCThreads();
+}
+
+void testSPSCBasicOperation() {
+
+    Test::reset();
+    std::cout << "***** SPSC Queue Basic *****" << '\n';
+
+    SPSCQueue<int> q{5};
+
+    Test::ASSERT(q.capacity() == 8, "SPSC: capacity power of two"); // #1
+    Test::ASSERT(q.sizeApprox() == 0, "SPSC: empty"); // #2
+    Test::ASSERT(!q.tryDequeue().has_value(), "SPSC: dequeue empty"); // #3
+
+    bool added{true};
+    for (int i{0}; i < 8; ++i)
+        added &= q.tryEnqueue(i);
+    Test::ASSERT(added && q.sizeApprox() == 8, "SPSC: fill"); // #4
+    Test::ASSERT(!q.tryEnqueue(8), "SPSC: enqueue full"); // #5
+
+    bool in_order{true};
+    for (int i{0}; i < 4; ++i)
+        in_order &= (q.tryDequeue() == i);
+    Test::ASSERT(in_order && q.sizeApprox() == 4, "SPSC: dequeue half"); // #6
+
+    // wrap around the end of the ring buffer
+    for (int i{8}; i < 12; ++i)
+        added &= q.tryEnqueue(i);
+    for (int i{4}; i < 12; ++i)
+        in_order &= (q.tryDequeue() == i);
+    Test::ASSERT(added && in_order, "SPSC: wrap around"); // #7
+    Test::ASSERT(!q.tryDequeue().has_value(), "SPSC: empty again"); // #8
+
+    // move-only objects; objects left in the queue are destroyed with it
+    SPSCQueue<std::unique_ptr<std::string>> p{4};
+    p.tryEnqueue(std::make_unique<std::string>("first"));
+    p.tryEmplace(new std::string{"second"});
+    p.tryEmplace(new std::string{"third"});
+
+    std::optional<std::unique_ptr<std::string>> first{p.tryDequeue()};
+    Test::ASSERT(first.has_value() && **first == "first",
+                 "SPSC: move-only dequeue"); // #9
+
+    Test::runReport();
+    std::cout << "****************************" << '\n' << '\n';
+}
+
+void testSPSCThreads() {
+
+    Test::reset();
+    std::cout << "***** SPSC Queue Threads *****" << '\n';
+
+    const int n{1'000'000};
+
+    // small capacity, so the producer frequently finds the queue full
+    SPSCQueue<int> q{64};
+
+    std::thread producer{[&q]() {
+        for (int i{0}; i < n; ++i) {
+            while (!q.tryEnqueue(i))
+                std::this_thread::yield();
+        }
+    }};
+
+    bool in_order{true};
+    for (int i{0}; i < n; ++i) {
+
+        std::optional<int> item{};
+        while (!(item = q.tryDequeue()))
+            std::this_thread::yield();
+
+        in_order &= (*item == i);
+    }
+
+    producer.join();
+
+    Test::ASSERT(in_order, "SPSC: threads, all objects in order"); // #1
+    Test::ASSERT(q.sizeApprox() == 0, "SPSC: threads, empty"); // #2
+
+    Test::runReport();
+    std::cout << "******************************" << '\n' << '\n';
+}
@@ -0,0 +1,115 @@
+/**
+ * \file    TestShardedSampler.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for ShardedSampler class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "ShardedSampler.h"
+#include "Test.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+void testShardedSampler() {
+
+    Test::reset();
+    std::cout << "***** Sharded Sampler *****" << '\n';
+
+    // words w0 through w19, of several lengths, across lines
+    const int n{20};
+    std::string text{};
+    std::vector<std::string> words{};
+    for (int i{0}; i < n; ++i) {
+        words.push_back(std::string{"w"}.append(std::to_string(i)));
+        text += words.back() + (i % 7 == 6 ? "\n" : "  ");
+    }
+
+    // each sample holds k distinct, whole words; each word equally likely to
+    // be included. Chi-square test at a significance level of 0.001, which
+    // is conservative for counts of inclusion, whose sum is fixed.
+    const int k{5};
+    const int trials{2'000};
+
+    std::vector<int> counts(n, 0);
+    bool whole{true};
+    for (int t{0}; t < trials; ++t) {
+
+        ShardedSampler sampler{k, 4};
+        std::vector<std::string_view> sample{sampler.sample(text)};
+
+        std::vector<bool> seen(n, false);
+        for (std::string_view word : sample) {
+            auto found{std::find(words.begin(), words.end(), word)};
+            whole &= (found != words.end());
+            if (found == words.end())
+                continue;
+            std::size_t i{static_cast<std::size_t>(found - words.begin())};
+            whole &= !seen[i];
+            seen[i] = true;
+            ++counts[i];
+        }
+        whole &= (static_cast<int>(sample.size()) == k &&
+                  sampler.itemsRead() == static_cast<std::uint64_t>(n));
+    }
+    Test::ASSERT(whole, "ShardedSampler: k distinct words"); // #1
+
+    double expected{static_cast<double>(trials) * k / n};
+    double chi2{0.0};
+    for (int c : counts)
+        chi2 += (c - expected) * (c - expected) / expected;
+    std::cout << "chi-square: words, 4 threads " << chi2 << '\n';
+    Test::ASSERT(chi2 < 43.82, "ShardedSampler: words uniform"); // #2
+
+    // more threads than words
+    {
+        ShardedSampler sampler{2, 8};
+        std::vector<std::string_view> sample{sampler.sample("one two three")};
+        Test::ASSERT(sample.size() == 2 && sampler.itemsRead() == 3,
+                     "ShardedSampler: more threads than words"); // #3
+    }
+
+    // weighted lines: blank lines are not items, lines without a valid
+    // weight are ignored, and line breaks are removed
+    const std::string lines{"a 1\n\nb x 2\nc 0\nd 3 4\r\n  \ne -1\nf\n"};
+    {
+        ShardedSampler sampler{3, 2, 2};
+        std::vector<std::string_view> sample{sampler.sample(lines)};
+        std::sort(sample.begin(), sample.end());
+        Test::ASSERT(sample.size() == 2 && sample[0] == "a 1" &&
+                     sample[1] == "d 3 4",
+                     "ShardedSampler: weighted lines"); // #4
+        Test::ASSERT(sampler.itemsRead() == 3 &&
+                     sampler.linesIgnored() == 3,
+                     "ShardedSampler: lines ignored"); // #5
+    }
+
+    // lines chosen with probability proportional to their weights; k = 1,
+    // chi-square test with 3 degrees of freedom
+    const std::string weighted{"a 1\nb 2\nc 3\nd 4\n"};
+    std::vector<int> chosen(4, 0);
+    for (int t{0}; t < 8'000; ++t) {
+
+        ShardedSampler sampler{1, 3, 2};
+        std::vector<std::string_view> sample{sampler.sample(weighted)};
+        if (sample.size() == 1)
+            ++chosen[static_cast<std::size_t>(sample.front().front() - 'a')];
+    }
+
+    double weighted_chi2{0.0};
+    for (std::size_t i{0}; i < chosen.size(); ++i) {
+        double e{8'000.0 * static_cast<double>(i + 1) / 10.0};
+        weighted_chi2 += (chosen[i] - e) * (chosen[i] - e) / e;
+    }
+    std::cout << "chi-square: weighted lines, 3 threads " << weighted_chi2
+              << '\n';
+    Test::ASSERT(weighted_chi2 < 16.27,
+                 "ShardedSampler: lines proportional to weight"); // #6
+
+    Test::runReport();
+    std::cout << "***************************" << '\n' << '\n';
+}
@@ -0,0 +1,252 @@
+/**
+ * \file    TestStaticDeque.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for StaticDeque class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "StaticDeque.h"
+#include "Test.h"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// allocator that counts allocations, of blocks and of the map
+template <typename T>
+struct CountingAllocator {
+
+    using value_type = T;
+
+    static inline int s_allocations{0};
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        ++s_allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    friend bool operator==(const CountingAllocator&, const CountingAllocator&)
+        { return true; }
+};
+
+// all allocations are counted together, whatever the type allocated
+int allocations() {
+
+    return CountingAllocator<int>::s_allocations +
+           CountingAllocator<int*>::s_allocations;
+}
+
+// object whose copy constructor throws once the countdown reaches zero;
+// with no move constructor, the deque copies it
+struct ThrowingCopy {
+
+    static inline int s_countdown{-1};
+
+    int value{0};
+
+    explicit ThrowingCopy(int v): value{v} {}
+    ThrowingCopy(const ThrowingCopy& other): value{other.value} {
+        if (s_countdown > 0 && --s_countdown == 0)
+            throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+};
+
+template <typename D>
+std::vector<int> toVector(const D& d) {
+
+    return std::vector<int>(d.begin(), d.end());
+}
+
+}
+
+static_assert(std::random_access_iterator<StaticDeque<int, 8>::iterator>);
+static_assert(std::ranges::random_access_range<const StaticDeque<int, 8>>);
+
+void testStaticDeque() {
+
+    Test::reset();
+    std::cout << "***** Static Deque *****" << '\n';
+
+    using SmallDeque = StaticDeque<int, 8, CountingAllocator<int>>;
+
+    SmallDeque d{};
+    Test::ASSERT(d.isEmpty() && d.isInline(), "StaticDeque: new"); // #1
+
+    // up to N objects at either end are held inline, without allocating
+    for (int i{0}; i < 4; ++i) {
+        d.addLast(i);
+        d.addFirst(-i - 1);
+    }
+    Test::ASSERT(d.size() == 8 && d.isInline() && allocations() == 0,
+                 "StaticDeque: N objects inline"); // #2
+    Test::ASSERT(toVector(d) == std::vector<int>{-4, -3, -2, -1, 0, 1, 2, 3},
+                 "StaticDeque: inline order"); // #3
+
+    // the next object spills the deque, in order
+    d.addFirst(-5);
+    d.addLast(4);
+    bool spilled{!d.isInline() && allocations() > 0 && d.size() == 10};
+    for (int i{0}; i < d.size(); ++i)
+        spilled &= (d[i] == i - 5 && d.at(i) == i - 5);
+    Test::ASSERT(spilled, "StaticDeque: spill in order"); // #4
+
+    // emptied, the deque returns inline; spilling again allocates nothing
+    while (!d.isEmpty())
+        d.removeLast();
+    bool returned{d.isInline()};
+    int spill_allocations{allocations()};
+    for (int i{0}; i < 20; ++i)
+        d.addLast(i);
+    while (!d.isEmpty())
+        d.removeFirst();
+    returned &= d.isInline() && allocations() == spill_allocations;
+    Test::ASSERT(returned, "StaticDeque: return inline, reuse"); // #5
+
+    // random operations compared with std::deque, across many spills
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> op{0, 4};
+    std::deque<int> reference{};
+    bool matched{true};
+    for (int i{0}; i < 20'000; ++i) {
+
+        int o{op(gen)};
+        if (o == 0) {
+
+            d.addFirst(i);
+            reference.push_front(i);
+
+        } else if (o == 1) {
+
+            d.addLast(i);
+            reference.push_back(i);
+
+        } else if (reference.empty()) {
+
+            continue;
+
+        } else if (o == 2) {
+
+            matched &= (d.removeFirst() == reference.front());
+            reference.pop_front();
+
+        } else if (o == 3) {
+
+            matched &= (d.removeLast() == reference.back());
+            reference.pop_back();
+
+        } else {
+
+            matched &= (d.peekFirst() == reference.front() &&
+                        d.peekLast() == reference.back());
+        }
+
+        matched &= (d.size() == static_cast<int>(reference.size()));
+        matched &= (d.isInline() || !reference.empty());
+    }
+    matched &= std::ranges::equal(d, reference);
+    Test::ASSERT(matched, "StaticDeque: random, against std::deque"); // #6
+
+    // an object added from the deque itself as it spills
+    d.clear();
+    for (int i{0}; i < 8; ++i)
+        d.addLast(i);
+    d.addFirst(d.peekLast());
+    Test::ASSERT(d.size() == 9 && d.peekFirst() == 7,
+                 "StaticDeque: add own object, spill"); // #7
+
+    // random access iterators, e.g., for sorting
+    std::ranges::sort(d);
+    Test::ASSERT(std::ranges::is_sorted(d) && d.peekLast() == 7 &&
+                 d.end() - d.begin() == 9, "StaticDeque: sort"); // #8
+
+    d.clear();
+    int caught{0};
+    try {
+        d.removeFirst();
+    } catch (const std::out_of_range&) {
+        ++caught;
+    }
+    try {
+        d.removeLast();
+    } catch (const std::out_of_range&) {
+        ++caught;
+    }
+    try {
+        d.peekFirst();
+    } catch (const std::out_of_range&) {
+        ++caught;
+    }
+    try {
+        d.at(0);
+    } catch (const std::out_of_range&) {
+        ++caught;
+    }
+    Test::ASSERT(caught == 4 && d.isInline(),
+                 "StaticDeque: empty, exceptions"); // #9
+
+    // objects that allocate are destroyed, inline and spilled
+    auto counted{std::make_shared<int>(0)};
+    {
+        StaticDeque<std::shared_ptr<int>, 4> s{};
+        for (int i{0}; i < 3; ++i)
+            s.addLast(counted);
+        StaticDeque<std::shared_ptr<int>, 4> t{};
+        for (int i{0}; i < 6; ++i)
+            t.addFirst(counted);
+        t.removeLast();
+    }
+    Test::ASSERT(counted.use_count() == 1,
+                 "StaticDeque: destructor destroys objects"); // #10
+
+    StaticDeque<std::string, 2> words{};
+    words.addLast("second");
+    words.emplaceFirst(5, 'a');
+    words.addLast("third");
+    Test::ASSERT(words.removeFirst() == "aaaaa" &&
+                 words.removeFirst() == "second" &&
+                 words.removeFirst() == "third" && words.isInline(),
+                 "StaticDeque: strings"); // #11
+
+    // a copy that throws part way through a spill leaves the deque inline
+    // and intact, and the next spill starts from an empty spill deque
+    StaticDeque<ThrowingCopy, 4> copies{};
+    for (int i{0}; i < 4; ++i)
+        copies.addLast(ThrowingCopy{i});
+    ThrowingCopy::s_countdown = 3;
+    bool rolled_back{false};
+    try {
+        copies.addLast(ThrowingCopy{10});
+    } catch (const std::runtime_error&) {
+        rolled_back = copies.isInline() && copies.size() == 4;
+    }
+    ThrowingCopy::s_countdown = -1;
+    copies.addLast(ThrowingCopy{10});
+    std::vector<int> copied{};
+    for (const ThrowingCopy& c : copies)
+        copied.push_back(c.value);
+    Test::ASSERT(rolled_back && copied == std::vector<int>{0, 1, 2, 3, 10},
+                 "StaticDeque: spill, copy throws"); // #12
+
+    Test::runReport();
+    std::cout << "************************" << '\n' << '\n';
+}
@@ -0,0 +1,140 @@
+/**
+ * \file    TestTaskScheduler.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for TaskScheduler class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "TaskScheduler.h"
+#include "Test.h"
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+void testSchedulerSubmit();
+void testSchedulerNested();
+
+void testTaskScheduler() {
+
+    testSchedulerSubmit();
+    testSchedulerNested();
+}
+
+void testSchedulerSubmit() {
+
+    Test::reset();
+    std::cout << "***** Task Scheduler Submit *****" << '\n';
+
+    TaskScheduler scheduler{4};
+    Test::ASSERT(scheduler.numWorkers() == 4, "Scheduler: workers"); // #1
+
+    // more tasks than the shared queue holds, so the submitter must wait
+    // for the workers to make room
+    const int n{10'000};
+    std::atomic<long long> sum{0};
+    for (int i{0}; i < n; ++i)
+        scheduler.submit([&sum, i]() { sum += i; });
+    scheduler.wait();
+
+    long long expected{static_cast<long long>(n) * (n - 1) / 2};
+    Test::ASSERT(sum == expected, "Scheduler: each task run once"); // #2
+
+    // wait with nothing submitted returns immediately
+    scheduler.wait();
+    Test::ASSERT(sum == expected, "Scheduler: wait when idle"); // #3
+
+    // a task that throws is counted as complete
+    std::atomic<int> after{0};
+    scheduler.submit([]() { throw std::runtime_error{"expected failure"}; });
+    scheduler.submit([&after]() { ++after; });
+    scheduler.wait();
+    Test::ASSERT(after == 1, "Scheduler: task throws"); // #4
+
+    // tasks submitted from several threads at once
+    std::atomic<int> count{0};
+    std::vector<std::thread> submitters{};
+    for (int t{0}; t < 3; ++t) {
+        submitters.emplace_back([&scheduler, &count]() {
+            for (int i{0}; i < 1'000; ++i)
+                scheduler.submit([&count]() { ++count; });
+        });
+    }
+    for (std::thread& t : submitters)
+        t.join();
+    scheduler.wait();
+    Test::ASSERT(count == 3'000, "Scheduler: concurrent submitters"); // #5
+
+    Test::runReport();
+    std::cout << "*********************************" << '\n' << '\n';
+}
+
+namespace {
+
+// count the leaves of a binary tree of the given depth, spawning a task for
+// each subtree
+void spawnTree(TaskScheduler& scheduler, int depth,
+               std::atomic<int>& leaves) {
+
+    if (depth == 0) {
+        ++leaves;
+        return;
+    }
+
+    scheduler.submit([&scheduler, depth, &leaves]() {
+        spawnTree(scheduler, depth - 1, leaves);
+    });
+    scheduler.submit([&scheduler, depth, &leaves]() {
+        spawnTree(scheduler, depth - 1, leaves);
+    });
+}
+
+}
+
+void testSchedulerNested() {
+
+    Test::reset();
+    std::cout << "***** Task Scheduler Nested *****" << '\n';
+
+    const int depth{14};
+
+    std::atomic<int> leaves{0};
+    {
+        TaskScheduler scheduler{4};
+        scheduler.submit([&scheduler, &leaves]() {
+            spawnTree(scheduler, depth, leaves);
+        });
+        scheduler.wait();
+        Test::ASSERT(leaves == (1 << depth),
+                     "Scheduler: nested tasks complete"); // #1
+    }
+
+    // destroying the scheduler completes the tasks still outstanding
+    std::atomic<int> leaves_at_exit{0};
+    {
+        TaskScheduler scheduler{2};
+        scheduler.submit([&scheduler, &leaves_at_exit]() {
+            spawnTree(scheduler, 10, leaves_at_exit);
+        });
+    }
+    Test::ASSERT(leaves_at_exit == (1 << 10),
+                 "Scheduler: destructor waits"); // #2
+
+    // a single worker runs everything itself
+    std::atomic<int> leaves_single{0};
+    {
+        TaskScheduler scheduler{1};
+        scheduler.submit([&scheduler, &leaves_single]() {
+            spawnTree(scheduler, 8, leaves_single);
+        });
+        scheduler.wait();
+    }
+    Test::ASSERT(leaves_single == (1 << 8),
+                 "Scheduler: single worker"); // #3
+
+    Test::runReport();
+    std::cout << "*********************************" << '\n' << '\n';
+}
@@ -0,0 +1,181 @@
+/**
+ * \file    TestWeightedReservoir.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for WeightedReservoir class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "WeightedReservoir.h"
+#include "Test.h"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+// offer the numbers [first, last), each of weight one, skipping ahead as the
+// permutation client does
+void offerUnits(WeightedReservoir<int>& reservoir, int first, int last) {
+
+    int next{first};
+    while (!reservoir.isFull() && next < last)
+        reservoir.offer(next++);
+
+    while (next < last) {
+
+        std::uint64_t skip{reservoir.unitSkip()};
+        std::uint64_t remaining{static_cast<std::uint64_t>(last - next)};
+        std::uint64_t skipped{skip < remaining ? skip : remaining};
+        reservoir.passOver(static_cast<double>(skipped));
+        next += static_cast<int>(skipped);
+
+        if (next < last)
+            reservoir.offer(next++);
+    }
+}
+
+// chi-square statistic of the given counts against the given probabilities
+double chiSquare(const std::vector<int>& counts,
+                 const std::vector<double>& probabilities, int trials) {
+
+    double chi2{0.0};
+    for (std::size_t i{0}; i < counts.size(); ++i) {
+        double expected{probabilities[i] * trials};
+        chi2 += (counts[i] - expected) * (counts[i] - expected) / expected;
+    }
+
+    return chi2;
+}
+
+}
+
+void testWeightedReservoir() {
+
+    Test::reset();
+    std::cout << "***** Weighted Reservoir *****" << '\n';
+
+    std::uint64_t seed{1};
+
+    // fewer than k items are all kept; items of zero weight are never kept
+    {
+        WeightedReservoir<int> reservoir{5, seed++};
+        reservoir.offer(1);
+        reservoir.offer(2, 0.0);
+        reservoir.offer(3, 0.5);
+        std::vector<int> items{reservoir.takeItems()};
+        Test::ASSERT(items.size() == 2 && reservoir.size() == 0,
+                     "Reservoir: fewer than k items"); // #1
+    }
+
+    // unit weights, skipping ahead and merging three parts of the stream;
+    // each item equally likely to be included. Chi-square tests at a
+    // significance level of 0.001, which are conservative for counts of
+    // inclusion, whose sum is fixed.
+    {
+        const int n{20};
+        const int k{5};
+        const int trials{10'000};
+
+        std::vector<int> counts(n, 0);
+        bool distinct{true};
+        for (int t{0}; t < trials; ++t) {
+
+            WeightedReservoir<int> first{k, seed++};
+            WeightedReservoir<int> second{k, seed++};
+            WeightedReservoir<int> third{k, seed++};
+            offerUnits(first, 0, 3);
+            offerUnits(second, 3, 12);
+            offerUnits(third, 12, n);
+            first.merge(std::move(second));
+            first.merge(std::move(third));
+
+            std::vector<int> items{first.takeItems()};
+            std::vector<bool> seen(n, false);
+            for (int i : items) {
+                distinct &= !seen[static_cast<std::size_t>(i)];
+                seen[static_cast<std::size_t>(i)] = true;
+                ++counts[static_cast<std::size_t>(i)];
+            }
+            distinct &= (static_cast<int>(items.size()) == k);
+        }
+        Test::ASSERT(distinct, "Reservoir: k distinct items"); // #2
+
+        double chi2{chiSquare(counts,
+                              std::vector<double>(n, 1.0 * k / n), trials)};
+        std::cout << "chi-square: unit weights, merged " << chi2 << '\n';
+        Test::ASSERT(chi2 < 43.82, "Reservoir: unit weights uniform"); // #3
+    }
+
+    // k = 1: each item chosen with probability proportional to its weight
+    const std::vector<double> weights{1.0, 2.0, 3.0, 4.0};
+    const double total{10.0};
+    {
+        const int trials{20'000};
+
+        std::vector<int> counts(weights.size(), 0);
+        for (int t{0}; t < trials; ++t) {
+
+            WeightedReservoir<int> reservoir{1, seed++};
+            for (std::size_t i{0}; i < weights.size(); ++i)
+                reservoir.offer(static_cast<int>(i), weights[i]);
+            ++counts[static_cast<std::size_t>(reservoir.takeItems().front())];
+        }
+
+        std::vector<double> probabilities{};
+        for (double w : weights)
+            probabilities.push_back(w / total);
+
+        double chi2{chiSquare(counts, probabilities, trials)};
+        std::cout << "chi-square: weighted, k = 1 " << chi2 << '\n';
+        Test::ASSERT(chi2 < 16.27, "Reservoir: weighted choice"); // #4
+    }
+
+    // k = 2 over two merged parts: each item included with the probability
+    // of being drawn first or second without replacement
+    {
+        const int trials{20'000};
+
+        std::vector<int> counts(weights.size(), 0);
+        for (int t{0}; t < trials; ++t) {
+
+            WeightedReservoir<int> first{2, seed++};
+            WeightedReservoir<int> second{2, seed++};
+            first.offer(0, weights[0]);
+            first.offer(3, weights[3]);
+            second.offer(1, weights[1]);
+            second.offer(2, weights[2]);
+            first.merge(std::move(second));
+
+            for (int i : first.takeItems())
+                ++counts[static_cast<std::size_t>(i)];
+        }
+
+        std::vector<double> probabilities{};
+        for (std::size_t i{0}; i < weights.size(); ++i) {
+            double p{weights[i] / total};
+            for (std::size_t j{0}; j < weights.size(); ++j)
+                if (j != i)
+                    p += weights[j] / total * weights[i] / (total - weights[j]);
+            probabilities.push_back(p);
+        }
+
+        double chi2{chiSquare(counts, probabilities, trials)};
+        std::cout << "chi-square: weighted, k = 2, merged " << chi2 << '\n';
+        Test::ASSERT(chi2 < 16.27, "Reservoir: weighted inclusion"); // #5
+    }
+
+    // random numbers drawn grow with k log(n/k), not with n
+    {
+        WeightedReservoir<int> reservoir{10, seed++};
+        offerUnits(reservoir, 0, 10'000'000);
+        std::cout << "random numbers drawn for n = 10^7, k = 10: "
+                  << reservoir.randomDraws() << '\n';
+        Test::ASSERT(reservoir.randomDraws() < 1'000,
+                     "Reservoir: draws sublinear"); // #6
+    }
+
+    Test::runReport();
+    std::cout << "******************************" << '\n' << '\n';
+}
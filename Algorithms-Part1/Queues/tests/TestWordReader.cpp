@@ -0,0 +1,130 @@
+/**
+ * \file    TestWordReader.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for WordReader class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "WordReader.h"
+#include "Test.h"
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// all words of the given text read with the given block size
+std::vector<std::string> readAll(const std::string& text,
+                                 std::size_t block_bytes) {
+
+    std::istringstream input{text};
+    WordReader reader{input, block_bytes};
+
+    std::vector<std::string> words{};
+    std::string_view word{};
+    while (reader.next(word))
+        words.emplace_back(word);
+
+    return words;
+}
+
+// all words of the given text read with operator>>
+std::vector<std::string> extractAll(const std::string& text) {
+
+    std::istringstream input{text};
+    std::vector<std::string> words{};
+    std::string word{};
+    while (input >> word)
+        words.push_back(word);
+
+    return words;
+}
+
+}
+
+void testWordReader() {
+
+    Test::reset();
+    std::cout << "***** Word Reader *****" << '\n';
+
+    Test::ASSERT(readAll("", 8).empty(), "WordReader: empty input"); // #1
+    Test::ASSERT(readAll(" \n\t\r\v\f ", 2).empty(),
+                 "WordReader: only whitespace"); // #2
+
+    std::vector<std::string> expected{"one", "two", "three", "four"};
+    Test::ASSERT(readAll("one two\nthree\t\tfour", 1'024) == expected,
+                 "WordReader: words across lines"); // #3
+    Test::ASSERT(readAll("  one two\nthree\t\tfour\n", 3) == expected,
+                 "WordReader: words across blocks"); // #4
+
+    // a word many times longer than a block grows the buffer
+    std::string long_word(100, 'x');
+    std::vector<std::string> long_expected{"a", long_word, "b"};
+    Test::ASSERT(readAll("a " + long_word + " b", 4) == long_expected,
+                 "WordReader: word longer than block"); // #5
+
+    // random text, with runs of mixed whitespace, for several block sizes
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> pick{0, 9};
+    const std::string_view spaces{" \n\t\r"};
+    std::string text{};
+    for (int i{0}; i < 5'000; ++i) {
+        int c{pick(gen)};
+        text += (c < 3) ? spaces[static_cast<std::size_t>(c)]
+                        : static_cast<char>('a' + c);
+    }
+
+    std::vector<std::string> reference{extractAll(text)};
+    bool matches{true};
+    for (std::size_t block : {1, 2, 7, 64, 4'096})
+        matches &= (readAll(text, block) == reference);
+    Test::ASSERT(matches, "WordReader: matches operator>>"); // #6
+
+    // skipping, and counts of bytes and words
+    std::istringstream input{"a bb ccc dddd eeeee"};
+    WordReader reader{input, 4};
+    std::string_view word{};
+
+    Test::ASSERT(reader.skip(2) == 2 && reader.next(word) && word == "ccc",
+                 "WordReader: skip"); // #7
+    Test::ASSERT(reader.skip(0) == 0 && reader.next(word) && word == "dddd",
+                 "WordReader: skip none"); // #8
+    Test::ASSERT(reader.skip(5) == 1 && !reader.next(word),
+                 "WordReader: skip past end"); // #9
+    Test::ASSERT(reader.bytesRead() == 19 && reader.wordsRead() == 5,
+                 "WordReader: bytes, words read"); // #10
+
+    // skips of random lengths, across blocks, then the word after each skip
+    bool skips_match{true};
+    for (std::size_t block : {1, 5, 16, 64, 4'096}) {
+
+        std::istringstream random_input{text};
+        WordReader skipper{random_input, block};
+        std::uniform_int_distribution<int> skip_length{0, 40};
+
+        std::size_t index{0};
+        while (true) {
+            std::uint64_t skip{static_cast<std::uint64_t>(skip_length(gen))};
+            std::uint64_t skipped{skipper.skip(skip)};
+            index += static_cast<std::size_t>(skipped);
+            if (skipped < skip || !skipper.next(word)) {
+                skips_match &= (index == reference.size());
+                break;
+            }
+            skips_match &= (index < reference.size() &&
+                            word == reference[index]);
+            ++index;
+        }
+        skips_match &= (skipper.wordsRead() == reference.size());
+    }
+    Test::ASSERT(skips_match, "WordReader: skips match operator>>"); // #11
+
+    Test::runReport();
+    std::cout << "***********************" << '\n' << '\n';
+}
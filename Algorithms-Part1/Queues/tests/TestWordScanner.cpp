@@ -0,0 +1,147 @@
+/**
+ * \file    TestWordScanner.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for WordScanner class, and the Whitespace functions.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "Whitespace.h"
+#include "WordScanner.h"
+#include "Test.h"
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// all words of the given text found by a scanner
+std::vector<std::string_view> scanAll(std::string_view text) {
+
+    WordScanner scanner{text};
+
+    std::vector<std::string_view> words{};
+    std::string_view word{};
+    while (scanner.next(word))
+        words.push_back(word);
+
+    return words;
+}
+
+// all words of the given text read with operator>>
+std::vector<std::string> extractAll(const std::string& text) {
+
+    std::istringstream input{text};
+    std::vector<std::string> words{};
+    std::string word{};
+    while (input >> word)
+        words.push_back(word);
+
+    return words;
+}
+
+}
+
+void testWordScanner() {
+
+    Test::reset();
+    std::cout << "***** Word Scanner *****" << '\n';
+
+    // every character is classified as std::isspace does, whether found in
+    // a group of sixteen or one at a time
+    bool classified{true};
+    for (int c{0}; c < 256; ++c) {
+
+        std::string text(40, 'x');
+        text[3] = static_cast<char>(c);
+        text[33] = static_cast<char>(c);
+        bool space{std::isspace(c) != 0};
+
+        classified &= (Whitespace::isSpace(static_cast<char>(c)) == space);
+        classified &= (Whitespace::findSpace(text.data(), 0, text.size()) ==
+                       (space ? 3u : text.size()));
+        classified &= (Whitespace::findSpace(text.data(), 20, text.size()) ==
+                       (space ? 33u : text.size()));
+    }
+    Test::ASSERT(classified, "Whitespace: all characters"); // #1
+
+    std::string spaces(37, ' ');
+    spaces[35] = 'y';
+    Test::ASSERT(Whitespace::findWord(spaces.data(), 0, spaces.size()) == 35 &&
+                 Whitespace::findWord(spaces.data(), 0, 35) == 35,
+                 "Whitespace: find word"); // #2
+
+    Test::ASSERT(scanAll("").empty(), "WordScanner: empty"); // #3
+    Test::ASSERT(scanAll(" \n\t\r\v\f ").empty(),
+                 "WordScanner: only whitespace"); // #4
+
+    std::vector<std::string_view> expected{"one", "two", "three", "four"};
+    Test::ASSERT(scanAll("  one two\nthree\t\tfour\n") == expected,
+                 "WordScanner: words across lines"); // #5
+
+    // words are views of the text, not copies
+    std::string text{"alpha beta"};
+    std::vector<std::string_view> words{scanAll(text)};
+    Test::ASSERT(words.size() == 2 && words[1].data() == text.data() + 6,
+                 "WordScanner: views in place"); // #6
+
+    // random text of words and whitespace of many lengths, so that words
+    // begin and end at every offset within a group of sixteen
+    std::mt19937 gen{2024};
+    std::uniform_int_distribution<int> length{1, 40};
+    std::uniform_int_distribution<int> pick{0, 5};
+    const std::string_view whitespace{" \t\n\v\f\r"};
+    std::string random_text{};
+    for (int i{0}; i < 2'000; ++i) {
+        random_text.append(static_cast<std::size_t>(length(gen)),
+                           static_cast<char>('a' + i % 26));
+        int gap{length(gen) / 8 + 1};
+        for (int g{0}; g < gap; ++g)
+            random_text += whitespace[static_cast<std::size_t>(pick(gen))];
+    }
+
+    std::vector<std::string> reference{extractAll(random_text)};
+    std::vector<std::string_view> scanned{scanAll(random_text)};
+    Test::ASSERT(std::vector<std::string>(scanned.begin(), scanned.end()) ==
+                 reference, "WordScanner: matches operator>>"); // #7
+
+    // skipping, and counts of bytes and words
+    WordScanner scanner{"a bb ccc dddd eeeee "};
+    std::string_view word{};
+
+    Test::ASSERT(scanner.skip(2) == 2 && scanner.next(word) && word == "ccc",
+                 "WordScanner: skip"); // #8
+    Test::ASSERT(scanner.skip(5) == 2 && !scanner.next(word),
+                 "WordScanner: skip past end"); // #9
+    Test::ASSERT(scanner.bytesRead() == 20 && scanner.wordsRead() == 5,
+                 "WordScanner: bytes, words read"); // #10
+
+    // skips of random lengths, then the word after each skip
+    WordScanner skipper{random_text};
+    std::uniform_int_distribution<int> skip_length{0, 40};
+    bool skips_match{true};
+
+    std::size_t index{0};
+    while (true) {
+        std::uint64_t skip{static_cast<std::uint64_t>(skip_length(gen))};
+        std::uint64_t skipped{skipper.skip(skip)};
+        index += static_cast<std::size_t>(skipped);
+        if (skipped < skip || !skipper.next(word)) {
+            skips_match &= (index == reference.size());
+            break;
+        }
+        skips_match &= (index < reference.size() && word == reference[index]);
+        ++index;
+    }
+    skips_match &= (skipper.wordsRead() == reference.size());
+    Test::ASSERT(skips_match, "WordScanner: skips match operator>>"); // #11
+
+    Test::runReport();
+    std::cout << "************************" << '\n' << '\n';
+}
@@ -0,0 +1,136 @@
+/**
+ * \file    TestWorkStealingDeque.cpp
+ * \author  Christine Jones
+ * \brief   Test cases for WorkStealingDeque class.
+ *
+ * \copyright 2024
+ * \license   GNU GENERAL PUBLIC LICENSE version 3
+ */
+
+#include "WorkStealingDeque.h"
+#include "Test.h"
+#include <atomic>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <vector>
+
+void testWSDequeBasicOperation();
+void testWSDequeThreads();
+
+void testWorkStealingDeque() {
+
+    testWSDequeBasicOperation();
+    testWSDequeThreads();
+}
+
+void testWSDequeBasicOperation() {
+
+    Test::reset();
+    std::cout << "***** Work-Stealing Deque Basic *****" << '\n';
+
+    WorkStealingDeque<int> d{3};
+
+    Test::ASSERT(d.capacity() == 4, "WSDeque: capacity power of two"); // #1
+    Test::ASSERT(d.sizeApprox() == 0, "WSDeque: empty"); // #2
+    Test::ASSERT(!d.pop().has_value(), "WSDeque: pop empty"); // #3
+    Test::ASSERT(!d.steal().has_value(), "WSDeque: steal empty"); // #4
+
+    for (int i{0}; i < 4; ++i)
+        d.push(i);
+    Test::ASSERT(d.sizeApprox() == 4, "WSDeque: push"); // #5
+
+    // owner removes most recent first; thieves remove oldest first
+    Test::ASSERT(d.pop() == 3, "WSDeque: pop from back"); // #6
+    Test::ASSERT(d.steal() == 0, "WSDeque: steal from front"); // #7
+    Test::ASSERT(d.sizeApprox() == 2, "WSDeque: size after remove"); // #8
+
+    // grow while the objects wrap around the end of the array
+    for (int i{4}; i < 20; ++i)
+        d.push(i);
+    Test::ASSERT(d.capacity() >= 18, "WSDeque: grow"); // #9
+
+    bool in_order{true};
+    in_order &= (d.steal() == 1);
+    in_order &= (d.steal() == 2);
+    for (int i{19}; i >= 4; --i)
+        in_order &= (d.pop() == i);
+    Test::ASSERT(in_order, "WSDeque: order preserved by grow"); // #10
+    Test::ASSERT(!d.pop().has_value() && !d.steal().has_value(),
+                 "WSDeque: empty again"); // #11
+    Test::ASSERT(d.sizeApprox() == 0, "WSDeque: size empty again"); // #12
+
+    Test::runReport();
+    std::cout << "*************************************" << '\n' << '\n';
+}
+
+void testWSDequeThreads() {
+
+    Test::reset();
+    std::cout << "***** Work-Stealing Deque Threads *****" << '\n';
+
+    const int num_thieves{3};
+    const int n{200'000};
+
+    // small initial capacity, so the owner grows the array while thieves
+    // are stealing from it
+    WorkStealingDeque<int> d{8};
+
+    std::vector<std::atomic<int>> removed(n);
+    std::atomic<int> total{0};
+    std::atomic<int> stolen{0};
+
+    std::vector<std::thread> thieves{};
+    for (int t{0}; t < num_thieves; ++t) {
+        thieves.emplace_back([&]() {
+            while (total.load(std::memory_order_relaxed) < n) {
+                std::optional<int> item{d.steal()};
+                if (!item) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                removed[static_cast<std::size_t>(*item)].fetch_add(1);
+                stolen.fetch_add(1);
+                total.fetch_add(1);
+            }
+        });
+    }
+
+    // owner pushes in bursts, popping some of each burst itself, so that
+    // the owner and thieves race for the last object
+    int next{0};
+    while (next < n) {
+
+        for (int i{0}; i < 64 && next < n; ++i)
+            d.push(next++);
+
+        for (int i{0}; i < 48; ++i) {
+            std::optional<int> item{d.pop()};
+            if (!item)
+                break;
+            removed[static_cast<std::size_t>(*item)].fetch_add(1);
+            total.fetch_add(1);
+        }
+    }
+
+    while (std::optional<int> item{d.pop()}) {
+        removed[static_cast<std::size_t>(*item)].fetch_add(1);
+        total.fetch_add(1);
+    }
+
+    for (std::thread& t : thieves)
+        t.join();
+
+    bool once{true};
+    for (const std::atomic<int>& count : removed)
+        once &= (count.load() == 1);
+
+    Test::ASSERT(total == n, "WSDeque: threads, all objects removed"); // #1
+    Test::ASSERT(once, "WSDeque: threads, each object once"); // #2
+    Test::ASSERT(d.sizeApprox() == 0, "WSDeque: threads, empty"); // #3
+
+    std::cout << "objects stolen: " << stolen << " of " << n << '\n';
+
+    Test::runReport();
+    std::cout << "***************************************" << '\n' << '\n';
+}